@@ -3,6 +3,7 @@
 #include <nall/dsp/iir/one-pole.hpp>
 #include <nall/dsp/iir/biquad.hpp>
 #include <nall/dsp/resampler/cubic.hpp>
+#include <nall/dsp/synthesis/blip.hpp>
 
 namespace Emulator {
 
@@ -15,6 +16,7 @@ struct Audio {
   ~Audio();
   auto reset(Interface* interface) -> void;
 
+  auto outputFrequency() const -> double { return frequency; }
   auto setFrequency(double frequency) -> void;
   auto setVolume(double volume) -> void;
   auto setBalance(double balance) -> void;
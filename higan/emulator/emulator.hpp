@@ -11,6 +11,7 @@
 #include <nall/random.hpp>
 #include <nall/serializer.hpp>
 #include <nall/shared-pointer.hpp>
+#include <nall/simd.hpp>
 #include <nall/string.hpp>
 #include <nall/traits.hpp>
 #include <nall/unique-pointer.hpp>
@@ -20,6 +20,7 @@ APU::APU() {
     }
   }
 
+#if defined(APU_TABLE_MIXER)
   for(uint dmc_amp : range(128)) {
     for(uint triangle_amp : range(16)) {
       for(uint noise_amp : range(16)) {
@@ -32,6 +33,15 @@ APU::APU() {
       }
     }
   }
+#else
+  for(uint amp : range(16)) {
+    triangleWeight[amp] = amp / 8227.0;
+    noiseWeight[amp] = amp / 12241.0;
+  }
+  for(uint amp : range(128)) {
+    dmcWeight[amp] = amp / 22638.0;
+  }
+#endif
 }
 
 auto APU::Enter() -> void {
@@ -39,6 +49,9 @@ auto APU::Enter() -> void {
 }
 
 auto APU::main() -> void {
+  //the ticks following this one share its output when no counter expires on any of them
+  uint idle = eventDriven ? idleTicks() : 0;
+
   uint pulse_output, triangle_output, noise_output, dmc_output;
 
   pulse_output  = pulse[0].clock();
@@ -49,20 +62,102 @@ auto APU::main() -> void {
 
   clockFrameCounterDivider();
 
+  if(bandlimited) {
+    synthesize(pulse_output, triangle_output, noise_output, dmc_output);
+    if(idle > 1) skip(idle - 1);
+    return tick();
+  }
+
   double output = 0.0;
   output += pulseDAC[pulse_output];
+#if defined(APU_TABLE_MIXER)
   output += dmcTriangleNoiseDAC[dmc_output][triangle_output][noise_output];
+#else
+  output += dmcTriangleNoiseMix(dmc_output, triangle_output, noise_output);
+#endif
   output += cartridgeSample;
   stream->sample(output);
 
   tick();
 }
 
+#if !defined(APU_TABLE_MIXER)
+auto APU::dmcTriangleNoiseMix(uint dmc, uint triangle, uint noise) const -> double {
+  //159.79 / (100 + 1 / x) rearranged so that x = 0 yields 0 without a branch
+  float x = triangleWeight[triangle] + noiseWeight[noise] + dmcWeight[dmc];
+  return 159.79f * x / (100.0f * x + 1.0f);
+}
+#endif
+
+auto APU::synthesize(uint pulse, uint triangle, uint noise, uint dmc) -> void {
+  uint channels = pulse | triangle << 5 | noise << 9 | dmc << 13;
+  if(channels != synthesis.channels || cartridgeSample != synthesis.cartridge) {
+    synthesis.channels = channels;
+    synthesis.cartridge = cartridgeSample;
+
+    double output = 0.0;
+    output += pulseDAC[pulse];
+#if defined(APU_TABLE_MIXER)
+    output += dmcTriangleNoiseDAC[dmc][triangle][noise];
+#else
+    output += dmcTriangleNoiseMix(dmc, triangle, noise);
+#endif
+    output += cartridgeSample;
+
+    int amplitude = output * SynthesisScale;
+    blip.addDelta(synthesis.clock, amplitude - synthesis.amplitude);
+    synthesis.amplitude = amplitude;
+  }
+
+  if(++synthesis.clock == SynthesisFrame) {
+    blip.endFrame(SynthesisFrame);
+    while(blip.pending()) stream->sample((double)blip.read() / SynthesisScale);
+    synthesis.clock = 0;
+  }
+}
+
 auto APU::tick() -> void {
   Thread::step(rate());
+  if(eventDriven) scheduleEvent();
   synchronize(cpu);
 }
 
+//ticks on which only the channel period counters and the frame divider count down
+auto APU::idleTicks() -> uint {
+  uint ticks = frame.divider > 0 ? (frame.divider - 1) / 2 : 0;
+  ticks = min(ticks, pulse[0].idleTicks());
+  ticks = min(ticks, pulse[1].idleTicks());
+  ticks = min(ticks, triangle.idleTicks());
+  ticks = min(ticks, noise.idleTicks());
+  ticks = min(ticks, dmc.idleTicks());
+  return ticks;
+}
+
+auto APU::skip(uint ticks) -> void {
+  //never start a tick at or past the CPU: register writes must still land on their exact tick
+  uintmax next = clock() + rate() * scalar();
+  if(cpu.clock() <= next) return;
+  ticks = min(ticks, (cpu.clock() - next - 1) / (rate() * scalar()) + 1);
+  ticks = min(ticks, SynthesisFrame - 1 - synthesis.clock);
+  if(ticks == 0) return;
+
+  pulse[0].skip(ticks);
+  pulse[1].skip(ticks);
+  triangle.skip(ticks);
+  noise.skip(ticks);
+  dmc.skip(ticks);
+  frame.divider -= ticks * 2;
+  synthesis.clock += ticks;
+  Thread::step(rate() * ticks);
+}
+
+//the next tick that can affect the CPU: a frame counter clock (IRQ) or DMC DMA activity
+auto APU::scheduleEvent() -> void {
+  uint ticks = frame.divider > 0 ? (frame.divider - 1) / 2 : 0;
+  if(dmc.lengthCounter > 0 || dmc.dmaDelayCounter > 0) ticks = min(ticks, dmc.idleTicks());
+  eventDistance = (uintmax)ticks * rate() * scalar();
+}
+
 auto APU::setIRQ() -> void {
   cpu.apuLine(frame.irqPending || dmc.irqPending);
 }
@@ -73,7 +168,16 @@ auto APU::setSample(int16 sample) -> void {
 
 auto APU::power(bool reset) -> void {
   create(APU::Enter, system.frequency());
-  stream = Emulator::audio.createStream(1, frequency() / rate());
+  if(!bandlimited) eventDriven = false;
+  eventDistance = 0;
+  if(bandlimited) {
+    double outputFrequency = Emulator::audio.outputFrequency();
+    blip.reset(frequency() / rate(), outputFrequency, SynthesisFrame);
+    synthesis = {};
+    stream = Emulator::audio.createStream(1, outputFrequency);
+  } else {
+    stream = Emulator::audio.createStream(1, frequency() / rate());
+  }
   stream->addFilter(Emulator::Filter::Order::First, Emulator::Filter::Type::HighPass, 90.0);
   stream->addFilter(Emulator::Filter::Order::First, Emulator::Filter::Type::HighPass, 440.0);
   stream->addFilter(Emulator::Filter::Order::First, Emulator::Filter::Type::LowPass, 14000.0);
@@ -98,6 +202,8 @@ auto APU::power(bool reset) -> void {
 }
 
 auto APU::readIO(uint16 addr) -> uint8 {
+  if(eventDriven && cpu.active()) cpu.synchronize(apu);
+
   switch(addr) {
 
   case 0x4015: {
@@ -122,6 +228,10 @@ auto APU::readIO(uint16 addr) -> uint8 {
 }
 
 auto APU::writeIO(uint16 addr, uint8 data) -> void {
+  //the write may start the DMC or reset the frame counter: reschedule on the next CPU step
+  if(eventDriven && cpu.active()) cpu.synchronize(apu);
+  eventDistance = 0;
+
   const uint n = (addr >> 2) & 1;  //pulse#
 
   switch(addr) {
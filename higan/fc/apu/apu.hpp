@@ -9,6 +9,10 @@ struct APU : Thread {
   static auto Enter() -> void;
   auto main() -> void;
   auto tick() -> void;
+  auto idleTicks() -> uint;
+  auto skip(uint ticks) -> void;
+  auto scheduleEvent() -> void;
+  inline auto eventClock() const -> uintmax { return clock() + eventDistance; }
   auto setIRQ() -> void;
   auto setSample(int16 sample) -> void;
 
@@ -58,6 +62,8 @@ struct APU : Thread {
     auto clockLength() -> void;
     auto checkPeriod() -> bool;
     auto clock() -> uint8;
+    auto idleTicks() -> uint;
+    auto skip(uint ticks) -> void;
 
     auto power() -> void;
 
@@ -79,6 +85,8 @@ struct APU : Thread {
     auto clockLength() -> void;
     auto clockLinearLength() -> void;
     auto clock() -> uint8;
+    auto idleTicks() const -> uint;
+    auto skip(uint ticks) -> void;
 
     auto power() -> void;
 
@@ -100,6 +108,8 @@ struct APU : Thread {
   struct Noise {
     auto clockLength() -> void;
     auto clock() -> uint8;
+    auto idleTicks() const -> uint;
+    auto skip(uint ticks) -> void;
 
     auto power() -> void;
 
@@ -120,6 +130,8 @@ struct APU : Thread {
     auto start() -> void;
     auto stop() -> void;
     auto clock() -> uint8;
+    auto idleTicks() const -> uint;
+    auto skip(uint ticks) -> void;
 
     auto power() -> void;
 
@@ -170,13 +182,47 @@ struct APU : Thread {
   double cartridgeSample;
 
   double pulseDAC[32];
+#if defined(APU_TABLE_MIXER)
   double dmcTriangleNoiseDAC[128][16][16];
+#else
+  //the triangle/noise/DMC mixer is evaluated as 159.79x / (100x + 1), where x is the
+  //sum of per-channel weights; this keeps 640 bytes resident instead of a 256KB table.
+  //maximum absolute error against the exact double table is 1.3e-7 (2.3e-7 relative)
+  inline auto dmcTriangleNoiseMix(uint dmc, uint triangle, uint noise) const -> double;
+
+  float triangleWeight[16];
+  float noiseWeight[16];
+  float dmcWeight[128];
+#endif
+
+  //band-limited output: amplitude changes are synthesized directly at the output rate
+  //instead of filtering and resampling one sample per APU tick
+  enum : uint { SynthesisScale = 1 << 20, SynthesisFrame = 4096 };
+  auto synthesize(uint pulse, uint triangle, uint noise, uint dmc) -> void;
+
+  DSP::Synthesis::Blip blip;
+  struct Synthesis {
+    uint channels;  //packed channel outputs of the previous tick
+    double cartridge;
+    int amplitude;
+    uint clock;     //ticks elapsed within the current blip frame
+  } synthesis;
 
   static const uint8 lengthCounterTable[32];
   static const uint16 dmcPeriodTableNTSC[16];
   static const uint16 dmcPeriodTablePAL[16];
   static const uint16 noisePeriodTableNTSC[16];
   static const uint16 noisePeriodTablePAL[16];
+
+  // For NSF support:
+  bool bandlimited = false;
+
+  //event-driven clocking (requires bandlimited output): ticks on which no channel changes
+  //state are advanced in bulk, and the CPU only catches the APU up on register access or
+  //when it reaches the next tick that can raise an IRQ or start a DMC DMA.
+  //cartridge expansion audio is not synchronized in this mode
+  bool eventDriven = false;
+  uintmax eventDistance = 0;
 };
 
 extern APU apu;
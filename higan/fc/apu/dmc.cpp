@@ -68,6 +68,16 @@ auto APU::DMC::clock() -> uint8 {
   return result;
 }
 
+//a pending or active DMA must be clocked every tick, as it drives the CPU RDY line
+auto APU::DMC::idleTicks() const -> uint {
+  if(dmaDelayCounter > 0 || (lengthCounter > 0 && !dmaBufferValid)) return 0;
+  return periodCounter - 1;
+}
+
+auto APU::DMC::skip(uint ticks) -> void {
+  periodCounter -= ticks;
+}
+
 auto APU::DMC::power() -> void {
   lengthCounter = 0;
   irqPending = 0;
@@ -25,6 +25,16 @@ auto APU::Noise::clock() -> uint8 {
   return result;
 }
 
+auto APU::Noise::idleTicks() const -> uint {
+  if(lengthCounter == 0) return ~0u;
+  return periodCounter - 1;
+}
+
+auto APU::Noise::skip(uint ticks) -> void {
+  if(lengthCounter == 0) return;
+  periodCounter -= ticks;
+}
+
 auto APU::Noise::power() -> void {
   lengthCounter = 0;
 
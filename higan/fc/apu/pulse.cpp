@@ -25,6 +25,17 @@ auto APU::Pulse::clock() -> uint8 {
   return result;
 }
 
+//ticks before the next duty step; the output holds until then
+auto APU::Pulse::idleTicks() -> uint {
+  if(!sweep.checkPeriod() || lengthCounter == 0) return ~0u;
+  return periodCounter - 1;
+}
+
+auto APU::Pulse::skip(uint ticks) -> void {
+  if(!sweep.checkPeriod() || lengthCounter == 0) return;
+  periodCounter -= ticks;
+}
+
 auto APU::Pulse::power() -> void {
   envelope.power();
   sweep.power();
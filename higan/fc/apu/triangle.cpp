@@ -27,6 +27,16 @@ auto APU::Triangle::clock() -> uint8 {
   return result;
 }
 
+auto APU::Triangle::idleTicks() const -> uint {
+  if(lengthCounter == 0 || linearLengthCounter == 0) return ~0u;
+  return periodCounter - 1;
+}
+
+auto APU::Triangle::skip(uint ticks) -> void {
+  if(lengthCounter == 0 || linearLengthCounter == 0) return;
+  periodCounter -= ticks;
+}
+
 auto APU::Triangle::power() -> void {
   lengthCounter = 0;
 
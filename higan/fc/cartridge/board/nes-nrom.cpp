@@ -32,6 +32,11 @@ struct NES_NROM : Board {
   }
 
   auto power() -> void {
+    //neither RAM nor PRG-ROM accesses have side effects on this board
+    bus.map(0x00, 0x1f, cpu.ram, sizeof(cpu.ram), true);
+    if(prgrom.size >= 0x100 && !(prgrom.size & prgrom.size - 1)) {
+      bus.map(0x80, 0xff, prgrom.data, prgrom.size);
+    }
   }
 
   auto serialize(serializer& s) -> void {
@@ -6,6 +6,11 @@ NSF::NSF(Markup::Node& document) : Board(document) {
   settings.addr_init = document["board/nsf/init"].natural();
   settings.addr_play = document["board/nsf/play"].natural();
 
+  // Play rate from the NSF header; zero selects the video frame rate:
+  bool pal = cartridge.region() == "PAL";
+  settings.play_speed = document["board/nsf/speed"][pal ? "pal" : "ntsc"].natural();
+  if (!settings.play_speed) settings.play_speed = pal ? 19997 : 16639;
+
 #if DEBUG_NSF
   print("init={0} play={1}\n", string_format{hex(settings.addr_init,4), hex(settings.addr_play,4)});
 #endif
@@ -48,18 +53,35 @@ NSF::NSF(Markup::Node& document) : Board(document) {
   // }
 }
 
+// Play timer: stands in for the PPU's vertical blank, which NSF playback does not emulate.
+// Each period pulses NMI while the bootstrap has play routine NMIs enabled, then ends the frame:
+auto NSF::main() -> void {
+  playCounter += (uint64_t)settings.play_speed * (uint64_t)(system.frequency() + 0.5);
+  cartridge.step(playCounter / 1000000);
+  playCounter %= 1000000;
+  cartridge.synchronize(cpu);
+
+  if (nmiFlags & 3) {
+    cpu.nmiLine(1);
+    cpu.nmiLine(0);
+  }
+  scheduler.exit(Scheduler::Event::Frame);
+}
+
 auto NSF::readPRG(uint addr) -> uint8 {
 #if DEBUG_NSF
   print("NSF read  PRG 0x{0}\n", string_format{hex(addr,4)});
 #endif
-  if (((nmiFlags&1) && song_reload) || (nmiFlags&2) || doreset) {
+  if (auto data = page[addr >> 12]) return data[addr & 0x0FFF];
+
+  if (overrideVectors()) {
     if (addr >= 0xFFFA && addr <= 0xFFFD) {
       // NMI:
       if (addr==0xFFFA) return(0x00);
       else if(addr==0xFFFB) return(0x38);
       // RESET:
       else if(addr==0xFFFC) return(0x20);
-      else if(addr==0xFFFD) { doreset = 0; return(0x38); }
+      else if(addr==0xFFFD) { doreset = 0; updatePages(); return(0x38); }
       // 0xFFFE is IRQ/BRK vector
     }
   }
@@ -72,6 +94,7 @@ auto NSF::readPRG(uint addr) -> uint8 {
       // print("read 3ff0\n");
       uint8 x = song_reload;
       song_reload = 0;
+      updatePages();
       return x;
     } else if (addr == 0x3ff1) {
       // print("read 3ff1: return song_index\n");
@@ -115,7 +138,9 @@ auto NSF::readPRG(uint addr) -> uint8 {
 }
 
 auto NSF::readPRGforced(uint addr) -> bool {
-  if (((nmiFlags&1) && song_reload) || (nmiFlags&2) || doreset) {
+  if (page[addr >> 12]) return true;
+
+  if (overrideVectors()) {
     if (addr >= 0xFFFA && addr <= 0xFFFD) {
       return true;
     }
@@ -137,9 +162,9 @@ auto NSF::writePRG(uint addr, uint8 data) -> void {
 
   switch(addr)
   {
-    case 0x3ff3: nmiFlags |=  1; break;
-    case 0x3ff4: nmiFlags &= ~2; break;
-    case 0x3ff5: nmiFlags |=  2; break;
+    case 0x3ff3: nmiFlags |=  1; updatePages(); break;
+    case 0x3ff4: nmiFlags &= ~2; updatePages(); break;
+    case 0x3ff5: nmiFlags |=  2; updatePages(); break;
 
     case 0x5FF6:
     case 0x5FF7: // if(!(NSFHeader.SoundChip&4)) return;
@@ -154,6 +179,7 @@ auto NSF::writePRG(uint addr, uint8 data) -> void {
       if (!bankSwitchEnabled) break;
       // print("bank[{0}] := {1}\n", string_format{hex(addr&0xF,1), hex(data,2)});
       bank[addr & 0x000F] = data;
+      updatePages();
       break;
   }
 }
@@ -194,6 +220,11 @@ auto NSF::power() -> void {
   nmiFlags = 0;
   doreset = 1;
   playing = false;
+  playCounter = 0;
+  updatePages();
+
+  // The player never observes RAM accesses:
+  bus.map(0x00, 0x1F, cpu.ram, sizeof(cpu.ram), true);
 }
 
 auto NSF::serialize(serializer& s) -> void {
@@ -204,6 +235,33 @@ auto NSF::serialize(serializer& s) -> void {
   s.integer(nmiFlags);
   s.integer(doreset);
   s.boolean(playing);
+  s.integer(playCounter);
   s.boolean(bankSwitchEnabled);
   for (auto i : range(16)) s.integer(bank[i]);
+  updatePages();
+}
+
+// The player bootstrap supplies the NMI and RESET vectors while it owns the CPU:
+auto NSF::overrideVectors() const -> bool {
+  return ((nmiFlags&1) && song_reload) || (nmiFlags&2) || doreset;
+}
+
+auto NSF::updatePages() -> void {
+  for (auto n : range(16)) {
+    page[n] = nullptr;
+    if (n < 8 || !prgrom.size) continue;
+    if (n == 15 && overrideVectors()) continue;
+
+    uint base = n << 12;
+    if (bankSwitchEnabled) base = (uint16)(bank[n] << 12);  // 16-bit, as in readPRG
+    // Only pages that map contiguously into PRGROM can be read directly:
+    uint lo = mirror(base, prgrom.size);
+    uint hi = mirror(base | 0x0FFF, prgrom.size);
+    if (hi == lo + 0x0FFF) page[n] = prgrom.data + lo;
+  }
+
+  for (auto n : range(8, 16)) {
+    if (page[n]) bus.map(n << 4, n << 4 | 0x0F, page[n], 0x1000);
+    else bus.unmap(n << 4, n << 4 | 0x0F);
+  }
 }
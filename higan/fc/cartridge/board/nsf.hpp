@@ -2,6 +2,8 @@
 struct NSF : Board {
   NSF(Markup::Node& document);
 
+  auto main() -> void override;
+
   auto readPRG(uint addr) -> uint8 override;
   auto writePRG(uint addr, uint8 data) -> void override;
   auto readPRGforced(uint addr) -> bool override;
@@ -14,12 +16,18 @@ struct NSF : Board {
 
   auto serialize(serializer& s) -> void override;
 
+  auto overrideVectors() const -> bool;
+  auto updatePages() -> void;
+
   struct Settings {
     bool mirror;      //0 = horizontal, 1 = vertical
     uint16 addr_init;
     uint16 addr_play;
+    uint play_speed;  //microseconds between play routine calls
   } settings;
 
+  uint64_t playCounter;  //fraction of a clock carried between play periods, in millionths
+
   uint8 nmiFlags;
   uint8 doreset;
 
@@ -30,6 +38,11 @@ struct NSF : Board {
   uint8 bank[0x10];
   bool playing;
 
+  //direct pointers to each 4KB page of $0000-$ffff, also published to the bus page table;
+  //nullptr selects the slow path, which covers the bootstrap ROM, the player registers,
+  //the overridden vectors and partial banks
+  uint8_t* page[0x10];
+
   /*
   00:8000:8D F4 3F  STA $3FF4 = #$00
   00:8003:A2 FF     LDX #$FF
@@ -30,13 +30,21 @@ auto Cartridge::load() -> bool {
   Board::load(information.manifest);  //this call will set Cartridge::board if successful
   if(!board) return false;
 
-  Hash::SHA256 sha;
-  sha.input(board->prgrom.data, board->prgrom.size);
-  sha.input(board->chrrom.data, board->chrrom.size);
-  information.sha256 = sha.digest();
+  information.sha256 = "";
   return true;
 }
 
+//hashed on first use: only the cheat tools ask for it
+auto Cartridge::hash() -> string {
+  if(!information.sha256 && board) {
+    Hash::SHA256 sha;
+    sha.input(board->prgrom.data, board->prgrom.size);
+    sha.input(board->chrrom.data, board->chrrom.size);
+    information.sha256 = sha.digest();
+  }
+  return information.sha256;
+}
+
 auto Cartridge::save() -> void {
   board->save();
 }
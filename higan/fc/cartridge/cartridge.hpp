@@ -10,7 +10,7 @@ struct Cartridge : Thread {
 
   auto pathID() const -> uint { return information.pathID; }
   auto region() const -> string { return information.region; }
-  auto hash() const -> string { return information.sha256; }
+  auto hash() -> string;
   auto manifest() const -> string { return information.manifest; }
   auto title() const -> string { return information.title; }
 
@@ -18,8 +18,8 @@ auto CPU::main() -> void {
 
 auto CPU::step(uint clocks) -> void {
   Thread::step(clocks);
-  synchronize(apu);
-  synchronize(ppu);
+  if(!apu.eventDriven || clock() >= apu.eventClock()) synchronize(apu);
+  if(!ppu.disabled) synchronize(ppu);
   synchronize(cartridge);
   for(auto peripheral : peripherals) synchronize(*peripheral);
 }
@@ -24,6 +24,7 @@ struct CPU : Processor::MOS6502, Thread {
   auto write(uint16 addr, uint8 data) -> void override;
   auto lastCycle() -> void override;
   auto nmi(uint16& vector) -> void override;
+  auto idleLoop() -> void override;
 
   auto oamdma() -> void;
 
@@ -37,7 +38,7 @@ struct CPU : Processor::MOS6502, Thread {
 //protected:
   vector<Thread*> peripherals;
 
-  uint8 ram[0x800];
+  uint8_t ram[0x800];
 
   struct IO {
     bool interruptPending = 0;
@@ -31,6 +31,33 @@ auto CPU::nmi(uint16& vector) -> void {
   }
 }
 
+//a branch to itself repeats the same three cycles until an interrupt is taken. the interrupt
+//lines only change when another thread runs, so every iteration that completes before the next
+//point at which one could is skipped by advancing the clock directly
+auto CPU::idleLoop() -> void {
+  //the lines may also have changed during the final cycle, after lastCycle() sampled them
+  if(io.interruptPending || io.nmiPending || ((io.irqLine | io.apuLine) && !r.p.i)) return;
+  if(!io.rdyLine || io.oamdmaPending) return;
+  uint16 pc = r.pc;
+  if((uint8)pc >= 0xfe) return;  //page crossing adds a cycle
+
+  //the skipped fetches must not have side effects
+  for(uint16 addr : range(pc, pc + 3)) {
+    if(addr >= 0x2000 && addr <= 0x401f && !cartridge.readPRGforced(addr)) return;
+  }
+
+  uintmax horizon = ppu.eventClock();
+  horizon = min(horizon, apu.eventDriven ? apu.eventClock() : apu.clock());
+  horizon = min(horizon, cartridge.clock());
+  for(auto peripheral : peripherals) horizon = min(horizon, peripheral->clock());
+
+  uintmax iteration = 3 * rate() * scalar();
+  if(horizon <= clock()) return;
+  if(uint iterations = (horizon - clock() - 1) / iteration) {
+    Thread::step(3 * rate() * iterations);
+  }
+}
+
 auto CPU::oamdma() -> void {
   for(uint n : range(256)) {
     uint8 data = read(io.oamdmaPage << 8 | n);
@@ -12,6 +12,14 @@ Bus bus;
 //$4018-ffff = Cartridge
 
 auto Bus::read(uint16 addr) -> uint8 {
+  if(auto page = reader[addr >> 8]) {
+    uint8 data = page[addr & 0xff];
+    if(cheat) {
+      if(auto result = cheat.find(addr, data)) return result();
+    }
+    return data;
+  }
+
   uint8 data = cartridge.readPRG(addr);
   if (!cartridge.readPRGforced(addr)) {
          if(addr <= 0x1fff) data = cpu.readRAM(addr);
@@ -31,6 +39,11 @@ auto Bus::read(uint16 addr) -> uint8 {
 }
 
 auto Bus::write(uint16 addr, uint8 data) -> void {
+  if(auto page = writer[addr >> 8]) {
+    page[addr & 0xff] = data;
+    return;
+  }
+
   cartridge.writePRG(addr, data);
   if (!cartridge.writePRGforced(addr)) {
     if(addr <= 0x1fff) return cpu.writeRAM(addr, data);
@@ -39,4 +52,23 @@ auto Bus::write(uint16 addr, uint8 data) -> void {
   }
 }
 
+auto Bus::reset() -> void {
+  unmap(0x00, 0xff);
+}
+
+//data is mirrored every size bytes, which must be a multiple of the page size
+auto Bus::map(uint8 pageLo, uint8 pageHi, uint8_t* data, uint size, bool writable) -> void {
+  for(uint page = pageLo; page <= pageHi; page++) {
+    reader[page] = data + ((page - pageLo) << 8) % size;
+    writer[page] = writable ? reader[page] : nullptr;
+  }
+}
+
+auto Bus::unmap(uint8 pageLo, uint8 pageHi) -> void {
+  for(uint page = pageLo; page <= pageHi; page++) {
+    reader[page] = nullptr;
+    writer[page] = nullptr;
+  }
+}
+
 }
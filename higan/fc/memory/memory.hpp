@@ -1,6 +1,16 @@
 struct Bus {
   auto read(uint16 addr) -> uint8;
   auto write(uint16 addr, uint8 data) -> void;
+
+  auto reset() -> void;
+  auto map(uint8 pageLo, uint8 pageHi, uint8_t* data, uint size, bool writable = false) -> void;
+  auto unmap(uint8 pageLo, uint8 pageHi) -> void;
+
+private:
+  //optional direct mappings for each 256-byte page; boards that fully describe a region
+  //publish it here, and every other page takes the cartridge -> RAM/PPU/IO path
+  uint8_t* reader[256];
+  uint8_t* writer[256];
 };
 
 extern Bus bus;
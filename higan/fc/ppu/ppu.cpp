@@ -36,6 +36,24 @@ auto PPU::step(uint clocks) -> void {
   }
 }
 
+//the earliest clock at which the PPU can next affect the CPU: the NMI line updates, and the end
+//of the frame. while rendering is off no cartridge accesses are made, so the dots in between
+//have no outside effects. without a PPU thread there are no such points
+auto PPU::eventClock() const -> uintmax {
+  if(disabled) return ~(uintmax)0;
+  if(enable()) return clock();
+
+  uint dots = vlines() * 341;
+  uint position = io.ly * 341 + io.lx;
+  uint distance = dots;
+  for(uint event : {241u * 341 + 2, (vlines() - 1) * 341 + 2, dots}) {
+    distance = min(distance, (event + dots - position - 1) % dots + 1);
+  }
+
+  //the dot following the current position begins at clock(); see step()
+  return clock() + (uintmax)(distance - 1) * rate() * scalar();
+}
+
 auto PPU::scanline() -> void {
   io.lx = 0;
   if(++io.ly == vlines()) {
@@ -55,6 +73,7 @@ auto PPU::refresh() -> void {
 }
 
 auto PPU::power(bool reset) -> void {
+  if(disabled) return;
   create(PPU::Enter, system.frequency());
 
   io = {};
@@ -6,6 +6,7 @@ struct PPU : Thread {
   static auto Enter() -> void;
   auto main() -> void;
   auto step(uint clocks) -> void;
+  auto eventClock() const -> uintmax;
 
   auto scanline() -> void;
   auto frame() -> void;
@@ -120,7 +121,7 @@ struct PPU : Thread {
 
   uint32 buffer[256 * 262];
 
-  // For NSF support:
+  //NSF playback: no PPU thread is created; the NSF board times the play routine instead
   bool disabled = false;
 };
 
@@ -14,7 +14,7 @@ auto System::run() -> void {
 auto System::runToSave() -> void {
   scheduler.synchronize(cpu);
   scheduler.synchronize(apu);
-  scheduler.synchronize(ppu);
+  if(!ppu.disabled) scheduler.synchronize(ppu);
   scheduler.synchronize(cartridge);
   for(auto peripheral : cpu.peripherals) scheduler.synchronize(*peripheral);
 }
@@ -68,6 +68,7 @@ auto System::power(bool reset) -> void {
   Emulator::audio.reset(interface);
 
   scheduler.reset();
+  bus.reset();
   cartridge.power();
   cpu.power(reset);
   apu.power(reset);
@@ -15,6 +15,7 @@ Cartridge cartridge;
 #include "huc1/huc1.cpp"
 #include "huc3/huc3.cpp"
 #include "tama/tama.cpp"
+#include "gbs/gbs.cpp"
 #include "serialization.cpp"
 
 auto Cartridge::Enter() -> void {
@@ -77,6 +78,7 @@ auto Cartridge::load() -> bool {
   if(mapperID == "HuC1" ) mapper = &huc1;
   if(mapperID == "HuC3" ) mapper = &huc3;
   if(mapperID == "TAMA" ) mapper = &tama;
+  if(mapperID == "GBS"  ) mapper = &gbs;
 
   accelerometer = (bool)document["game/board/accelerometer"];
   rumble = (bool)document["game/board/rumble"];
@@ -109,11 +111,16 @@ auto Cartridge::load() -> bool {
     }
   }
 
-  information.sha256 = Hash::SHA256({rom.data, rom.size}).digest();
   mapper->load(document);
   return true;
 }
 
+//hashed on first use: only the cheat tools ask for it
+auto Cartridge::hash() -> string {
+  if(!information.sha256 && rom.data) information.sha256 = Hash::SHA256({rom.data, rom.size}).digest();
+  return information.sha256;
+}
+
 auto Cartridge::save() -> void {
   auto document = BML::unserialize(information.manifest);
 
@@ -137,9 +144,9 @@ auto Cartridge::save() -> void {
 }
 
 auto Cartridge::unload() -> void {
-  delete[] rom.data;
-  delete[] ram.data;
-  delete[] rtc.data;
+  memory::free(rom.data);
+  memory::free(ram.data);
+  memory::free(rtc.data);
   rom = {};
   ram = {};
   rtc = {};
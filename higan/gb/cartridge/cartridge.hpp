@@ -1,6 +1,6 @@
 struct Cartridge : Thread, MMIO {
   auto pathID() const -> uint { return information.pathID; }
-  auto hash() const -> string { return information.sha256; }
+  auto hash() -> string;
   auto manifest() const -> string { return information.manifest; }
   auto title() const -> string { return information.title; }
 
@@ -63,6 +63,7 @@ private:
   #include "huc1/huc1.hpp"
   #include "huc3/huc3.hpp"
   #include "tama/tama.hpp"
+  #include "gbs/gbs.hpp"
 };
 
 extern Cartridge cartridge;
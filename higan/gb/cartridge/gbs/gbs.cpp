@@ -0,0 +1,101 @@
+auto Cartridge::GBS::load(Markup::Node document) -> void {
+  auto node = document["game/board/gbs"];
+  settings.load = node["load"].natural();
+  settings.init = node["init"].natural();
+  settings.play = node["play"].natural();
+  settings.stack = node["stack"].natural();
+  settings.timerModulo = node["timer/modulo"].natural();
+  settings.timerControl = node["timer/control"].natural();
+  settings.song = node["song"].natural();
+
+  uint n = 0;
+  auto byte = [&](uint8 data) { player[n++] = data; };
+  auto word = [&](uint16 data) { byte(data >> 0); byte(data >> 8); };
+  for(auto& data : player) data = 0x00;
+
+  //RST $00-$38: jump to the same offset from the load address
+  for(uint vector = 0x00; vector <= 0x38; vector += 8) {
+    n = vector;
+    byte(0xc3); word(settings.load + vector);  //JP load+vector
+  }
+
+  //the vblank and timer interrupts call the play routine; the others only return
+  for(uint vector = 0x40; vector <= 0x60; vector += 8) {
+    n = vector;
+    if(vector == 0x40 || vector == 0x50) byte(0xcd), word(settings.play);  //CALL play
+    byte(0xd9);  //RETI
+  }
+
+  n = 0x70;
+  byte(0x31); word(settings.stack);                   //LD SP,stack
+  byte(0x3e); byte(0x80); byte(0xe0); byte(0x26);     //NR52: sound on
+  byte(0x3e); byte(0x77); byte(0xe0); byte(0x24);     //NR50: full volume
+  byte(0x3e); byte(0xff); byte(0xe0); byte(0x25);     //NR51: all channels to both outputs
+  byte(0x3e); byte(settings.timerModulo); byte(0xe0); byte(0x06);         //TMA
+  byte(0x3e); byte(settings.timerControl & 0x07); byte(0xe0); byte(0x07);  //TAC
+  if(settings.timerControl.bit(7) && Model::GameBoyColor()) {
+    byte(0x3e); byte(0x01); byte(0xe0); byte(0x4d);   //KEY1: request the speed switch
+    byte(0x10); byte(0x00);                           //STOP
+  }
+  byte(0x3e); byte(settings.timerControl.bit(2) ? 0x04 : 0x01); byte(0xe0); byte(0xff);  //IE
+  byte(0xaf); byte(0xe0); byte(0x0f);                 //IF: clear
+  byte(0x3e); byte(settings.song);                    //LD A,song
+  byte(0xcd); word(settings.init);                    //CALL init
+  byte(0xfb);                                         //EI
+  byte(0x76);                                         //HALT
+  byte(0x18); byte(0xfd);                             //JR -3
+}
+
+//there is no PPU: this thread stands in for its vblank interrupt, which requests the play routine
+//when the timer does not. each frame is reported, so the player can keep time in either mode
+auto Cartridge::GBS::main() -> void {
+  cartridge.step(154 * 456);
+  if(!settings.timerControl.bit(2)) cpu.raise(CPU::Interrupt::Vblank);
+  scheduler.exit(Scheduler::Event::Frame);
+}
+
+auto Cartridge::GBS::read(uint16 address) -> uint8 {
+  if(address < 0x0100) {  //$0000-00ff
+    if(address == 0x0070) io.reset = false;
+    if(io.reset && address <= 0x0002) return address == 0 ? 0xc3 : address == 1 ? 0x70 : 0x00;  //JP $0070
+    return player[address];
+  }
+
+  if((address & 0xc000) == 0x0000) {  //$0100-3fff
+    return cartridge.rom.read(address.bits(0,13));
+  }
+
+  if((address & 0xc000) == 0x4000) {  //$4000-7fff
+    return cartridge.rom.read(io.rom.bank << 14 | address.bits(0,13));
+  }
+
+  if((address & 0xe000) == 0xa000) {  //$a000-bfff
+    return cartridge.ram.read(address.bits(0,12));
+  }
+
+  return 0xff;
+}
+
+auto Cartridge::GBS::write(uint16 address, uint8 data) -> void {
+  if((address & 0xe000) == 0x2000) {  //$2000-3fff
+    io.rom.bank = data;
+    if(!io.rom.bank) io.rom.bank = 0x01;
+    return;
+  }
+
+  if((address & 0xe000) == 0xa000) {  //$a000-bfff
+    cartridge.ram.write(address.bits(0,12), data);
+    return;
+  }
+}
+
+auto Cartridge::GBS::power() -> void {
+  io = {};
+  //there is no boot ROM; execution begins in the player
+  cartridge.bootromEnable = false;
+}
+
+auto Cartridge::GBS::serialize(serializer& s) -> void {
+  s.integer(io.rom.bank);
+  s.integer(io.reset);
+}
@@ -0,0 +1,31 @@
+//Game Boy Sound System rips: the song data is loaded at its own address, and a small player
+//in the first page of bank 0 calls the init routine, then the play routine from an interrupt
+struct GBS : Mapper {
+  auto load(Markup::Node document) -> void override;
+  auto main() -> void override;
+  auto read(uint16 address) -> uint8 override;
+  auto write(uint16 address, uint8 data) -> void override;
+  auto power() -> void override;
+  auto serialize(serializer&) -> void override;
+
+  struct Settings {
+    uint16 load;
+    uint16 init;
+    uint16 play;
+    uint16 stack;
+    uint8 timerModulo;
+    uint8 timerControl;  //d2 = play from the timer interrupt rather than vblank; d7 = double speed
+    uint8 song;          //0-based
+  } settings;
+
+  //$0000-$00ff, below the load address: restart vectors relocated to the load address,
+  //interrupt vectors that call the play routine, and the entry code that calls init
+  uint8 player[0x100];
+
+  struct IO {
+    struct ROM {
+      uint9 bank = 0x01;
+    } rom;
+    bool reset = true;  //$0000 jumps to the entry code until it is reached
+  } io;
+} gbs;
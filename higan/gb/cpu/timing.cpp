@@ -17,7 +17,7 @@ auto CPU::step(uint clocks) -> void {
     if((status.div & 1023) == 0)   timer4096hz();
 
     Thread::step(1);
-    synchronize(ppu);
+    if(!ppu.disabled) synchronize(ppu);
     synchronize(apu);
     synchronize(cartridge);
   }
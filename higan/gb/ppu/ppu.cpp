@@ -109,6 +109,7 @@ auto PPU::hflip(uint data) const -> uint {
 }
 
 auto PPU::power() -> void {
+  if(disabled) return;
   create(Enter, 4 * 1024 * 1024);
 
   if(Model::GameBoyColor()) {
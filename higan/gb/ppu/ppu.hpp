@@ -127,6 +127,9 @@ struct PPU : Thread, MMIO {
   };
   Background background;
   Background window;
+
+  //GBS playback: no PPU thread is created; the GBS mapper times the play routine instead
+  bool disabled = false;
 };
 
 extern PPU ppu;
@@ -13,7 +13,7 @@ auto System::run() -> void {
 
 auto System::runToSave() -> void {
   scheduler.synchronize(cpu);
-  scheduler.synchronize(ppu);
+  if(!ppu.disabled) scheduler.synchronize(ppu);
   scheduler.synchronize(apu);
   scheduler.synchronize(cartridge);
 }
@@ -167,6 +167,9 @@ struct APU : Thread, IO {
     uint1 renable;
     uint1 timer;
 
+    //called with each sample taken from the FIFO, at the rate of its timer
+    function<void (int8)> capture;
+
     auto sample() -> void;
     auto read() -> void;
     auto write(int8 byte) -> void;
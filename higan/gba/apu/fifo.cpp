@@ -3,9 +3,11 @@ auto APU::FIFO::sample() -> void {
 }
 
 auto APU::FIFO::read() -> void {
-  if(size == 0) return;
-  size--;
-  active = samples[rdoffset++];
+  if(size) {
+    size--;
+    active = samples[rdoffset++];
+  }
+  if(capture) capture(active);
 }
 
 auto APU::FIFO::write(int8 byte) -> void {
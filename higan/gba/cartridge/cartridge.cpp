@@ -94,10 +94,15 @@ auto Cartridge::load() -> bool {
     }
   }
 
-  information.sha256 = Hash::SHA256({mrom.data, mrom.size}).digest();
   return true;
 }
 
+//hashed on first use: only the cheat tools ask for it
+auto Cartridge::hash() -> string {
+  if(!information.sha256 && mrom.data) information.sha256 = Hash::SHA256({mrom.data, mrom.size}).digest();
+  return information.sha256;
+}
+
 auto Cartridge::save() -> void {
   auto document = BML::unserialize(information.manifest);
 
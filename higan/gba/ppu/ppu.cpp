@@ -67,7 +67,7 @@ auto PPU::main() -> void {
     if(io.vcoincidence) cpu.irq.flag |= CPU::Interrupt::VCoincidence;
   }
 
-  if(io.vcounter < 160) {
+  if(io.vcounter < 160 && !disabled) {
     uint y = io.vcounter;
     bg0.scanline(y);
     bg1.scanline(y);
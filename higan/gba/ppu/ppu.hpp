@@ -32,6 +32,9 @@ struct PPU : Thread, IO {
   uint16 pram[512];
   uint32* output;
 
+  //no rendering; scanline timing, interrupts and DMA triggers are kept
+  bool disabled = false;
+
 private:
   //note: I/O register order is {BG0-BG3, OBJ, SFX}
   //however; layer ordering is {OBJ, BG0-BG3, SFX}
@@ -182,6 +182,7 @@ auto Interface::get(const string& name) -> any {
 }
 
 auto Interface::set(const string& name, const any& value) -> bool {
+  if(name == "Sound Only" && value.is<bool>()) return settings.soundOnly = value.get<bool>(), true;
   return false;
 }
 
@@ -59,6 +59,7 @@ struct Settings {
   uint controllerPort1 = ID::Device::ControlPad;
   uint controllerPort2 = ID::Device::ControlPad;
   uint extensionPort = ID::Device::None;
+  bool soundOnly = false;
 };
 
 extern Settings settings;
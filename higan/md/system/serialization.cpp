@@ -48,6 +48,12 @@ auto System::unserialize(serializer& s) -> bool {
 
 auto System::serializeAll(serializer& s) -> void {
   system.serialize(s);
+  if(soundOnly()) {
+    psg.serialize(s);
+    ym2612.serialize(s);
+    return;
+  }
+
   cartridge.serialize(s);
   cpu.serialize(s);
   apu.serialize(s);
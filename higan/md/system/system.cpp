@@ -13,6 +13,12 @@ auto System::run() -> void {
 }
 
 auto System::runToSave() -> void {
+  if(soundOnly()) {
+    scheduler.synchronize(psg);
+    scheduler.synchronize(ym2612);
+    return;
+  }
+
   scheduler.synchronize(cpu);
   scheduler.synchronize(apu);
   scheduler.synchronize(vdp);
@@ -22,25 +28,35 @@ auto System::runToSave() -> void {
 
 auto System::load(Emulator::Interface* interface, maybe<Region> region) -> bool {
   information = {};
+  information.soundOnly = settings.soundOnly;
+
+  //sound-only: no cartridge, 68K or Z80; the caller writes the YM2612 and PSG and clocks them directly
+  string regionName;
+  if(soundOnly()) {
+    if(auto loaded = platform->load(ID::MegaDrive, "Mega Drive", "md", {"NTSC-J", "NTSC-U", "PAL"})) {
+      regionName = loaded.option;
+    } else return false;
+  } else {
+    if(auto fp = platform->open(ID::System, "manifest.bml", File::Read, File::Required)) {
+      information.manifest = fp->reads();
+    } else return false;
+
+    auto document = BML::unserialize(information.manifest);
+    auto system = document["system"];
+    if(!cpu.load(system)) return false;
+    if(!cartridge.load()) return false;
+    regionName = cartridge.region();
+  }
 
-  if(auto fp = platform->open(ID::System, "manifest.bml", File::Read, File::Required)) {
-    information.manifest = fp->reads();
-  } else return false;
-
-  auto document = BML::unserialize(information.manifest);
-  auto system = document["system"];
-  if(!cpu.load(system)) return false;
-  if(!cartridge.load()) return false;
-
-  if(cartridge.region() == "NTSC-J") {
+  if(regionName == "NTSC-J") {
     information.region = Region::NTSCJ;
     information.frequency = Emulator::Constants::Colorburst::NTSC * 15.0;
   }
-  if(cartridge.region() == "NTSC-U") {
+  if(regionName == "NTSC-U") {
     information.region = Region::NTSCU;
     information.frequency = Emulator::Constants::Colorburst::NTSC * 15.0;
   }
-  if(cartridge.region() == "PAL") {
+  if(regionName == "PAL") {
     information.region = Region::PAL;
     information.frequency = Emulator::Constants::Colorburst::PAL * 12.0;
   }
@@ -55,6 +71,11 @@ auto System::save() -> void {
 }
 
 auto System::unload() -> void {
+  if(soundOnly()) {
+    information.loaded = false;
+    return;
+  }
+
   cpu.peripherals.reset();
   controllerPort1.unload();
   controllerPort2.unload();
@@ -63,6 +84,21 @@ auto System::unload() -> void {
 }
 
 auto System::power(bool reset) -> void {
+  if(soundOnly()) {
+    Emulator::audio.reset(interface);
+    random.entropy(Random::Entropy::High);
+
+    scheduler.reset();
+    psg.power(reset);
+    ym2612.power(reset);
+    scheduler.primary(ym2612);
+
+    //there are no 68K or Z80 threads: park their clocks so that the sound chips never wait on them
+    cpu.setClock(~(uintmax)0);
+    apu.setClock(~(uintmax)0);
+    return;
+  }
+
   Emulator::video.reset(interface);
   Emulator::video.setPalette();
 
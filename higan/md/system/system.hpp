@@ -8,6 +8,7 @@ struct System {
   auto loaded() const -> bool { return information.loaded; }
   auto region() const -> Region { return information.region; }
   auto frequency() const -> double { return information.frequency; }
+  auto soundOnly() const -> bool { return information.soundOnly; }
 
   auto run() -> void;
   auto runToSave() -> void;
@@ -30,6 +31,7 @@ private:
   struct Information {
     string manifest;
     bool loaded = false;
+    bool soundOnly = false;
     Region region = Region::NTSCJ;
     double frequency = Emulator::Constants::Colorburst::NTSC * 15.0;
     uint serializeSize = 0;
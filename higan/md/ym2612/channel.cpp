@@ -7,7 +7,7 @@ auto YM2612::Channel::Operator::trigger(bool state) -> void {
 
   if(keyOn) {
     //restart phase and envelope generators
-    phase.value = 0;
+    phase() = 0;
     ssg.invert = false;
     envelope.state = Attack;
     updateEnvelope();
@@ -55,10 +55,10 @@ auto YM2612::Channel::Operator::runEnvelope() -> void {
 }
 
 auto YM2612::Channel::Operator::runPhase() -> void {
-  phase.value += phase.delta;  //advance wave position
+  //the wave position has already been advanced for all operators by advancePhases()
   if(!(ssg.enable && envelope.value >= 0x200)) return;  //SSG loop check
 
-  if(!ssg.hold && !ssg.alternate) phase.value = 0;
+  if(!ssg.hold && !ssg.alternate) phase() = 0;
   if(!ssg.hold || ssg.attack == ssg.invert) ssg.invert ^= ssg.alternate;
 
   if(envelope.state == Attack) {
@@ -119,9 +119,9 @@ auto YM2612::Channel::Operator::updatePhase() -> void {
   uint msb = 10;
   while(msb > 4 && ~pitch.value & 1 << msb) msb--;
 
-  phase.delta = pitch.value + (pm >> 10 - msb) << 6 >> 7 - octave.value;
-  phase.delta = (!detune.bit(2) ? phase.delta + tuning : phase.delta - tuning) & 0x1ffff;
-  phase.delta = (multiple ? phase.delta * multiple : phase.delta >> 1) & 0xfffff;
+  uint32_t step = pitch.value + (pm >> 10 - msb) << 6 >> 7 - octave.value;
+  step = (!detune.bit(2) ? step + tuning : step - tuning) & 0x1ffff;
+  delta() = (multiple ? step * multiple : step >> 1) & 0xfffff;
 }
 
 auto YM2612::Channel::Operator::updateLevel() -> void {
@@ -131,7 +131,7 @@ auto YM2612::Channel::Operator::updateLevel() -> void {
   bool invert = ssg.attack != ssg.invert && envelope.state != Release;
   uint10 value = ssg.enable && invert ? 0x200 - envelope.value : 0 + envelope.value;
 
-  outputLevel = ((totalLevel << 3) + value + (lfoEnable ? lfo << 1 >> depth : 0)) << 3;
+  outputLevel() = ((totalLevel << 3) + value + (lfoEnable ? lfo << 1 >> depth : 0)) << 3;
 }
 
 auto YM2612::Channel::power() -> void {
@@ -144,6 +144,7 @@ auto YM2612::Channel::power() -> void {
   tremolo = 0;
 
   mode = 0;
+  updateRouting();
 
   for(auto& op : operators) {
     op.keyOn = 0;
@@ -152,9 +153,9 @@ auto YM2612::Channel::power() -> void {
     op.multiple = 0;
     op.totalLevel = 0;
 
-    op.outputLevel = 0x1fff;
-    op.output = 0;
-    op.prior = 0;
+    op.outputLevel() = 0x1fff;
+    op.output() = 0;
+    op.prior() = 0;
 
     op.pitch.value = 0;
     op.pitch.reload = 0;
@@ -164,8 +165,8 @@ auto YM2612::Channel::power() -> void {
     op.octave.reload = 0;
     op.octave.latch = 0;
 
-    op.phase.value = 0;
-    op.phase.delta = 0;
+    op.phase() = 0;
+    op.delta() = 0;
 
     op.envelope.state = Release;
     op.envelope.rate = 0;
@@ -196,6 +196,7 @@ auto YM2612::writeData(uint8 data) -> void {
   case 0x0b0: {
     channel.algorithm = data.bits(0,2);
     channel.feedback = data.bits(3,5);
+    channel.updateRouting();
     break;
   }
 
@@ -0,0 +1,129 @@
+//structure-of-arrays operator evaluation: the state read every sample is kept as [operator][channel],
+//so each of the four operator stages is computed for all six channels at once. algorithm routing is
+//applied through per-channel masks rather than branches, which keeps the results identical to the
+//per-channel operator chains.
+
+auto YM2612::Channel::Operator::phase() -> uint32_t& { return ym2612.lanes.phase[index][channel.index]; }
+auto YM2612::Channel::Operator::delta() -> uint32_t& { return ym2612.lanes.delta[index][channel.index]; }
+auto YM2612::Channel::Operator::outputLevel() -> uint32_t& { return ym2612.lanes.outputLevel[index][channel.index]; }
+auto YM2612::Channel::Operator::output() -> int32_t& { return ym2612.lanes.output[index][channel.index]; }
+auto YM2612::Channel::Operator::prior() -> int32_t& { return ym2612.lanes.prior[index][channel.index]; }
+
+auto YM2612::Channel::updateRouting() -> void {
+  auto& lanes = ym2612.lanes;
+  auto mask = [](bool select) -> int32_t { return select ? ~0 : 0; };
+  uint n = index;
+
+  lanes.feedbackShift[n] = 9 - feedback;
+  lanes.feedbackEnable[n] = mask(feedback > 0);
+
+  //0: 0 -> 1 -> 2 -> 3
+  //1: (0 + 1) -> 2 -> 3
+  //2: 0 + (1 -> 2) -> 3
+  //3: (0 -> 1) + 2 -> 3
+  //4: (0 -> 1) + (2 -> 3)
+  //5: 0 -> (1 + 2 + 3)
+  //6: (0 -> 1) + 2 + 3
+  //7: 0 + 1 + 2 + 3
+  lanes.route1[0][n] = mask(algorithm == 0 || algorithm == 3 || algorithm == 4 || algorithm == 5 || algorithm == 6);
+  lanes.route2[0][n] = mask(algorithm <= 2);
+  lanes.route2[1][n] = mask(algorithm == 1);
+  lanes.route2[2][n] = mask(algorithm == 5);
+  lanes.route3[0][n] = mask(algorithm <= 4);
+  lanes.route3[1][n] = mask(algorithm == 2 || algorithm == 5);
+  lanes.route3[2][n] = mask(algorithm == 3);
+  lanes.carrier[0][n] = mask(algorithm == 7);
+  lanes.carrier[1][n] = mask(algorithm >= 4);
+  lanes.carrier[2][n] = mask(algorithm >= 5);
+}
+
+auto YM2612::advancePhases() -> void {
+  for(auto n : range(4)) {
+    for(auto c : range(8)) {
+      lanes.phase[n][c] = lanes.phase[n][c] + lanes.delta[n][c] & 0xfffff;
+    }
+  }
+}
+
+//computes every operator's output for this sample, and each channel's carrier sum
+auto YM2612::evaluateOperators(int32_t accumulator[8]) -> void {
+  const int modMask = -(1 << 1);
+  const int sumMask = -(1 << 5);
+
+  #if defined(SIMD_AVX2)
+  auto load = [](const void* data) -> __m256i { return _mm256_load_si256((const __m256i*)data); };
+  auto store = [](void* data, __m256i value) -> void { _mm256_store_si256((__m256i*)data, value); };
+  auto mask = [](__m256i value, int32_t mask) -> __m256i { return _mm256_and_si256(value, _mm256_set1_epi32(mask)); };
+  auto select = [](const int32_t* route, __m256i value) -> __m256i { return _mm256_and_si256(_mm256_load_si256((const __m256i*)route), value); };
+
+  auto wave = [&](uint n, __m256i modulation) -> __m256i {
+    __m256i x = _mm256_add_epi32(_mm256_srai_epi32(modulation, 1), _mm256_srli_epi32(load(lanes.phase[n]), 10));
+    __m256i y = _mm256_i32gather_epi32((const int*)sine, mask(x, 0x3ff), 4);
+    y = _mm256_add_epi32(y, load(lanes.outputLevel[n]));
+    __m256i z = _mm256_i32gather_epi32((const int*)pow2, mask(y, 0x1ff), 4);
+    z = _mm256_srav_epi32(_mm256_slli_epi32(z, 2), _mm256_srli_epi32(y, 9));
+    return _mm256_and_si256(z, _mm256_cmpgt_epi32(_mm256_set1_epi32(0x2000), y));
+  };
+
+  __m256i feedback = _mm256_add_epi32(load(lanes.output[0]), load(lanes.prior[0]));
+  feedback = mask(_mm256_srav_epi32(feedback, load(lanes.feedbackShift)), modMask);
+  feedback = select(lanes.feedbackEnable, feedback);
+
+  for(auto n : range(4)) store(lanes.prior[n], load(lanes.output[n]));
+  __m256i old0 = mask(load(lanes.prior[0]), modMask);
+  __m256i old1 = mask(load(lanes.prior[1]), modMask);
+
+  __m256i output0 = wave(0, feedback);
+  __m256i mod0 = mask(output0, modMask);
+  __m256i output1 = wave(1, select(lanes.route1[0], mod0));
+  __m256i mod1 = mask(output1, modMask);
+  __m256i output2 = wave(2, _mm256_add_epi32(_mm256_add_epi32(
+    select(lanes.route2[0], old1), select(lanes.route2[1], mod0)), select(lanes.route2[2], old0)));
+  __m256i mod2 = mask(output2, modMask);
+  __m256i output3 = wave(3, _mm256_add_epi32(_mm256_add_epi32(
+    select(lanes.route3[0], mod2), select(lanes.route3[1], mod0)), select(lanes.route3[2], mod1)));
+
+  store(lanes.output[0], output0);
+  store(lanes.output[1], output1);
+  store(lanes.output[2], output2);
+  store(lanes.output[3], output3);
+
+  __m256i sum = mask(output3, sumMask);
+  sum = _mm256_add_epi32(sum, select(lanes.carrier[0], mask(output0, sumMask)));
+  sum = _mm256_add_epi32(sum, select(lanes.carrier[1], mask(output1, sumMask)));
+  sum = _mm256_add_epi32(sum, select(lanes.carrier[2], mask(output2, sumMask)));
+  _mm256_storeu_si256((__m256i*)accumulator, sum);
+  #else
+  for(auto c : range(6)) {
+    auto wave = [&](uint n, uint modulation) -> int {
+      int x = (modulation >> 1) + (lanes.phase[n][c] >> 10);
+      int y = sine[x & 0x3ff] + lanes.outputLevel[n][c];
+      return y < 0x2000 ? pow2[y & 0x1ff] << 2 >> (y >> 9) : 0;
+    };
+
+    int feedback = lanes.feedbackEnable[c] & (modMask & lanes.output[0][c] + lanes.prior[0][c] >> lanes.feedbackShift[c]);
+
+    for(auto n : range(4)) lanes.prior[n][c] = lanes.output[n][c];
+    int old0 = lanes.prior[0][c] & modMask;
+    int old1 = lanes.prior[1][c] & modMask;
+
+    int output0 = wave(0, feedback);
+    int mod0 = output0 & modMask;
+    int output1 = wave(1, lanes.route1[0][c] & mod0);
+    int mod1 = output1 & modMask;
+    int output2 = wave(2, (lanes.route2[0][c] & old1) + (lanes.route2[1][c] & mod0) + (lanes.route2[2][c] & old0));
+    int mod2 = output2 & modMask;
+    int output3 = wave(3, (lanes.route3[0][c] & mod2) + (lanes.route3[1][c] & mod0) + (lanes.route3[2][c] & mod1));
+
+    lanes.output[0][c] = output0;
+    lanes.output[1][c] = output1;
+    lanes.output[2][c] = output2;
+    lanes.output[3][c] = output3;
+
+    accumulator[c] = (output3 & sumMask)
+                   + (lanes.carrier[0][c] & output0 & sumMask)
+                   + (lanes.carrier[1][c] & output1 & sumMask)
+                   + (lanes.carrier[2][c] & output2 & sumMask);
+  }
+  #endif
+}
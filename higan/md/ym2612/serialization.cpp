@@ -38,6 +38,7 @@ auto YM2612::Channel::serialize(serializer& s) -> void {
   s.integer(vibrato);
   s.integer(tremolo);
   s.integer(mode);
+  updateRouting();
 
   for(auto n : range(4)) operators[n].serialize(s);
 }
@@ -48,9 +49,9 @@ auto YM2612::Channel::Operator::serialize(serializer& s) -> void {
   s.integer(detune);
   s.integer(multiple);
   s.integer(totalLevel);
-  s.integer(outputLevel);
-  s.integer(output);
-  s.integer(prior);
+  s.integer(outputLevel());
+  s.integer(output());
+  s.integer(prior());
 
   s.integer(pitch.value);
   s.integer(pitch.reload);
@@ -60,8 +61,8 @@ auto YM2612::Channel::Operator::serialize(serializer& s) -> void {
   s.integer(octave.reload);
   s.integer(octave.latch);
 
-  s.integer(phase.value);
-  s.integer(phase.delta);
+  s.integer(phase());
+  s.integer(delta());
 
   s.integer(envelope.state);
   s.integer(envelope.rate);
@@ -7,6 +7,7 @@ YM2612 ym2612;
 #include "timer.cpp"
 #include "channel.cpp"
 #include "constants.cpp"
+#include "lanes.cpp"
 #include "serialization.cpp"
 
 auto YM2612::Enter() -> void {
@@ -35,6 +36,7 @@ auto YM2612::main() -> void {
     envelope.clock++;
   }
 
+  advancePhases();
   for(auto& channel : channels) {
     for(auto& op : channel.operators) {
       op.runPhase();
@@ -47,98 +49,16 @@ auto YM2612::main() -> void {
 }
 
 auto YM2612::sample() -> void {
+  alignas(32) int32_t accumulator[8];
+  evaluateOperators(accumulator);
+
   int left = 0;
   int right = 0;
 
   for(auto& channel : channels) {
-    auto& op = channel.operators;
-
-    const int modMask = -(1 << 1);
-    const int sumMask = -(1 << 5);
     const int outMask = -(1 << 5);
 
-    auto old = [&](uint n) -> int { return op[n].prior  & modMask; };
-    auto mod = [&](uint n) -> int { return op[n].output & modMask; };
-    auto out = [&](uint n) -> int { return op[n].output & sumMask; };
-
-    auto wave = [&](uint n, uint modulation) -> int {
-      int x = (modulation >> 1) + (op[n].phase.value >> 10);
-      int y = sine[x & 0x3ff] + op[n].outputLevel;
-      return y < 0x2000 ? pow2[y & 0x1ff] << 2 >> (y >> 9) : 0;
-    };
-
-    int feedback = modMask & op[0].output + op[0].prior >> 9 - channel.feedback;
-    int accumulator = 0;
-
-    for(auto n : range(4)) op[n].prior = op[n].output;
-
-    op[0].output = wave(0, feedback * (channel.feedback > 0));
-
-    if(channel.algorithm == 0) {
-      //0 -> 1 -> 2 -> 3
-      op[1].output = wave(1, mod(0));
-      op[2].output = wave(2, old(1));
-      op[3].output = wave(3, mod(2));
-      accumulator += out(3);
-    }
-
-    if(channel.algorithm == 1) {
-      //(0 + 1) -> 2 -> 3
-      op[1].output = wave(1, 0);
-      op[2].output = wave(2, mod(0) + old(1));
-      op[3].output = wave(3, mod(2));
-      accumulator += out(3);
-    }
-
-    if(channel.algorithm == 2) {
-      //0 + (1 -> 2) -> 3
-      op[1].output = wave(1, 0);
-      op[2].output = wave(2, old(1));
-      op[3].output = wave(3, mod(0) + mod(2));
-      accumulator += out(3);
-    }
-
-    if(channel.algorithm == 3) {
-      //(0 -> 1) + 2 -> 3
-      op[1].output = wave(1, mod(0));
-      op[2].output = wave(2, 0);
-      op[3].output = wave(3, mod(1) + mod(2));
-      accumulator += out(3);
-    }
-
-    if(channel.algorithm == 4) {
-      //(0 -> 1) + (2 -> 3)
-      op[1].output = wave(1, mod(0));
-      op[2].output = wave(2, 0);
-      op[3].output = wave(3, mod(2));
-      accumulator += out(1) + out(3);
-    }
-
-    if(channel.algorithm == 5) {
-      //0 -> (1 + 2 + 3)
-      op[1].output = wave(1, mod(0));
-      op[2].output = wave(2, old(0));
-      op[3].output = wave(3, mod(0));
-      accumulator += out(1) + out(2) + out(3);
-    }
-
-    if(channel.algorithm == 6) {
-      //(0 -> 1) + 2 + 3
-      op[1].output = wave(1, mod(0));
-      op[2].output = wave(2, 0);
-      op[3].output = wave(3, 0);
-      accumulator += out(1) + out(2) + out(3);
-    }
-
-    if(channel.algorithm == 7) {
-      //0 + 1 + 2 + 3
-      op[1].output = wave(1, 0);
-      op[2].output = wave(2, 0);
-      op[3].output = wave(3, 0);
-      accumulator += out(0) + out(1) + out(2) + out(3);
-    }
-
-    int voiceData = sclamp<14>(accumulator) & outMask;
+    int voiceData = sclamp<14>(accumulator[channel.index]) & outMask;
     if(dac.enable && (&channel == &channels[5])) voiceData = (int)dac.sample - 0x80 << 6;
 
     if(channel.leftEnable ) left  += voiceData;
@@ -166,6 +86,11 @@ auto YM2612::power(bool reset) -> void {
   envelope = {};
   timerA = {};
   timerB = {};
+  lanes = {};
+  for(auto n : range(6)) {
+    channels[n].index = n;
+    for(auto m : range(4)) channels[n].operators[m].index = m;
+  }
   for(auto& channel : channels) channel.power();
 
   const uint positive = 0;
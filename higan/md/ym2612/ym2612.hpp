@@ -6,6 +6,10 @@ struct YM2612 : Thread {
   static auto Enter() -> void;
   auto main() -> void;
   auto sample() -> void;
+
+  //lanes.cpp
+  auto advancePhases() -> void;
+  auto evaluateOperators(int32_t accumulator[8]) -> void;
   auto step(uint clocks) -> void;
 
   auto power(bool reset) -> void;
@@ -69,6 +73,9 @@ private:
     //channel.cpp
     auto power() -> void;
 
+    //lanes.cpp
+    auto updateRouting() -> void;
+
     //serialization.cpp
     auto serialize(serializer&) -> void;
 
@@ -81,6 +88,7 @@ private:
     uint2 tremolo = 0;
 
     uint2 mode = 0;
+    uint index = 0;  //lane
 
     struct Operator {
       Channel& channel;
@@ -97,6 +105,13 @@ private:
       auto updatePhase() -> void;
       auto updateLevel() -> void;
 
+      //lanes.cpp
+      auto phase() -> uint32_t&;
+      auto delta() -> uint32_t&;
+      auto outputLevel() -> uint32_t&;
+      auto output() -> int32_t&;
+      auto prior() -> int32_t&;
+
       //serialization.cpp
       auto serialize(serializer&) -> void;
 
@@ -105,10 +120,7 @@ private:
       uint3 detune = 0;
       uint4 multiple = 0;
       uint7 totalLevel = 0;
-
-      uint16 outputLevel = 0x1fff;
-      int16  output = 0;
-      int16  prior = 0;
+      uint  index = 0;
 
       struct Pitch {
         uint11 value = 0;
@@ -122,11 +134,6 @@ private:
         uint3 latch = 0;
       } octave;
 
-      struct Phase {
-        uint20 value = 0;
-        uint20 delta = 0;
-      } phase;
-
       struct Envelope {
         uint   state = Release;
         int    rate = 0;
@@ -154,8 +161,26 @@ private:
     auto operator[](uint2 index) -> Operator& { return operators[index]; }
   } channels[6];
 
-  uint16 sine[0x400];
-  int16  pow2[0x200];
+  //operator state read every sample, as [operator][channel] with channels padded to eight lanes
+  struct Lanes {
+    alignas(32) uint32_t phase[4][8];        //uint20 wave position
+    alignas(32) uint32_t delta[4][8];        //uint20 wave step
+    alignas(32) uint32_t outputLevel[4][8];  //attenuation
+    alignas(32) int32_t  output[4][8];
+    alignas(32) int32_t  prior[4][8];
+
+    //algorithm routing: all-ones masks selecting each operator's modulation inputs and the carriers summed
+    alignas(32) int32_t  feedbackShift[8];   //right shift of the operator 0 sum
+    alignas(32) int32_t  feedbackEnable[8];
+    alignas(32) int32_t  route1[1][8];       //operator 1: mod(0)
+    alignas(32) int32_t  route2[3][8];       //operator 2: old(1), mod(0), old(0)
+    alignas(32) int32_t  route3[3][8];       //operator 3: mod(2), mod(0), mod(1)
+    alignas(32) int32_t  carrier[3][8];      //carriers 0-2; operator 3 is always a carrier
+  } lanes;
+
+  //widened to 32 bits so that they can be gathered directly
+  uint32_t sine[0x400];
+  int32_t  pow2[0x200];
 
   //constants.cpp
   struct EnvelopeRate {
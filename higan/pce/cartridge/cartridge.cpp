@@ -34,10 +34,15 @@ auto Cartridge::load() -> bool {
     }
   }
 
-  information.sha256 = Hash::SHA256({rom.data, rom.size}).digest();
   return true;
 }
 
+//hashed on first use: only the cheat tools ask for it
+auto Cartridge::hash() -> string {
+  if(!information.sha256 && rom.data) information.sha256 = Hash::SHA256({rom.data, rom.size}).digest();
+  return information.sha256;
+}
+
 auto Cartridge::save() -> void {
   auto document = BML::unserialize(information.manifest);
 }
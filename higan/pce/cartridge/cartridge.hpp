@@ -1,6 +1,6 @@
 struct Cartridge {
   auto pathID() const -> uint { return information.pathID; }
-  auto hash() const -> string { return information.sha256; }
+  auto hash() -> string;
   auto manifest() const -> string { return information.manifest; }
   auto title() const -> string { return information.title; }
 
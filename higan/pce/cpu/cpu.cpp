@@ -21,9 +21,13 @@ auto CPU::main() -> void {
 auto CPU::step(uint clocks) -> void {
   Thread::step(clocks);
   timer.step(clocks);
-  synchronize(vdc0);
-  synchronize(vdc1);
-  synchronize(vce);
+  if(!system.soundOnly()) {
+    synchronize(vdc0);
+    synchronize(vdc1);
+    synchronize(vce);
+  } else {
+    frameStep(clocks);
+  }
   synchronize(psg);
   for(auto peripheral : peripherals) synchronize(*peripheral);
 }
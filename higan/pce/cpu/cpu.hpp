@@ -19,6 +19,7 @@ struct CPU : Processor::HuC6280, Thread {
 
   //timer.cpp
   auto timerStep(uint clocks) -> void;
+  auto frameStep(uint clocks) -> void;
 
   //serialization.cpp
   auto serialize(serializer&) -> void;
@@ -66,6 +67,7 @@ private:
 
   struct IO {
     uint8 mdr;
+    uint frameClock = 0;  //sound-only
   } io;
 };
 
@@ -101,6 +101,10 @@ auto CPU::read_(uint8 bank, uint13 addr) -> uint8 {
 
     //$1c00-1fff  unmapped
     if((addr & 0x1c00) == 0x1c00) {
+      //sound-only: the end of the page holds a loop that waits for interrupts, for a caller
+      //that runs a subroutine directly to return to
+      static const uint8 idle[3] = {0x58, 0x80, 0xfe};  //CLI; BRA $1ffe
+      if(system.soundOnly() && addr >= 0x1ffd) return idle[addr - 0x1ffd];
       return 0xff;
     }
   }
@@ -18,4 +18,5 @@ auto CPU::serialize(serializer& s) -> void {
   s.integer(timer.line);
 
   s.integer(io.mdr);
+  s.integer(io.frameClock);
 }
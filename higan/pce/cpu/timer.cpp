@@ -14,3 +14,13 @@ auto CPU::Timer::step(uint clocks) -> void {
     }
   }
 }
+
+//sound-only: without a VDC thread, the CPU raises the vblank IRQ once every 262 lines of 1365
+//VDC clocks, and ends the frame there
+auto CPU::frameStep(uint clocks) -> void {
+  io.frameClock += clocks;
+  if(io.frameClock < 262 * 1365 / 3) return;
+  io.frameClock -= 262 * 1365 / 3;
+  vdc0.vblank();
+  scheduler.exit(Scheduler::Event::Frame);
+}
@@ -63,6 +63,7 @@ struct SuperGrafxInterface : Interface {
 
 struct Settings {
   uint controllerPort = ID::Device::Gamepad;
+  bool soundOnly = false;
 };
 
 extern Settings settings;
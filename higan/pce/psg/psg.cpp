@@ -66,4 +66,12 @@ auto PSG::power() -> void {
   volumeScalar[31] = 0.0;
 }
 
+//copies a channel's wave buffer while the channel is audibly playing from it
+auto PSG::waveform(uint C, uint8_t samples[32]) const -> bool {
+  auto& io = channel[C].io;
+  if(!io.enable || io.direct || io.noiseEnable || !io.volume) return false;
+  for(auto n : range(32)) samples[n] = io.waveBuffer[n];
+  return true;
+}
+
 }
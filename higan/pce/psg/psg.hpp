@@ -8,6 +8,7 @@ struct PSG : Thread {
   auto step(uint clocks) -> void;
 
   auto power() -> void;
+  auto waveform(uint channel, uint8_t samples[32]) const -> bool;
 
   //io.cpp
   auto write(uint4 addr, uint8 data) -> void;
@@ -12,6 +12,12 @@ auto System::run() -> void {
 }
 
 auto System::runToSave() -> void {
+  if(soundOnly()) {
+    scheduler.synchronize(cpu);
+    scheduler.synchronize(psg);
+    return;
+  }
+
   scheduler.synchronize(cpu);
   scheduler.synchronize(vce);
   scheduler.synchronize(vdc0);
@@ -22,6 +28,7 @@ auto System::runToSave() -> void {
 auto System::load(Emulator::Interface* interface, Model model) -> bool {
   information = {};
   information.model = model;
+  information.soundOnly = settings.soundOnly;
 
   if(auto fp = platform->open(ID::System, "manifest.bml", File::Read, File::Required)) {
     information.manifest = fp->reads();
@@ -49,18 +56,23 @@ auto System::unload() -> void {
 }
 
 auto System::power() -> void {
-  Emulator::video.reset(interface);
-  Emulator::video.setPalette();
+  if(!soundOnly()) {
+    Emulator::video.reset(interface);
+    Emulator::video.setPalette();
+  }
 
   Emulator::audio.reset(interface);
 
   scheduler.reset();
   cartridge.power();
   cpu.power();
-  vce.power();
-  vpc.power();
-  vdc0.power();
-  vdc1.power();
+  //sound-only: there are no VCE, VPC or VDC threads; the CPU keeps the frame timing in their place
+  if(!soundOnly()) {
+    vce.power();
+    vpc.power();
+    vdc0.power();
+    vdc1.power();
+  }
   psg.power();
   scheduler.primary(cpu);
 
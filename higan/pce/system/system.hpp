@@ -4,6 +4,7 @@ struct System {
   inline auto loaded() const -> bool { return information.loaded; }
   inline auto model() const -> Model { return information.model; }
   inline auto colorburst() const -> double { return information.colorburst; }
+  inline auto soundOnly() const -> bool { return information.soundOnly; }
 
   auto run() -> void;
   auto runToSave() -> void;
@@ -27,6 +28,7 @@ private:
   struct Information {
     bool loaded = false;
     Model model = Model::PCEngine;
+    bool soundOnly = false;
     string manifest;
     double colorburst = 0.0;
     uint serializeSize = 0;
@@ -86,6 +86,11 @@ auto VDC::frame() -> void {
   timing.vpulse = true;
 }
 
+//sound-only: there is no VDC thread; the CPU signals the start of vblank in its place
+auto VDC::vblank() -> void {
+  irq.raise(IRQ::Line::Vblank);
+}
+
 auto VDC::step(uint clocks) -> void {
   Thread::step(clocks);
   synchronize(cpu);
@@ -9,6 +9,7 @@ struct VDC : Thread {
   auto step(uint clocks) -> void;
   auto scanline() -> void;
   auto frame() -> void;
+  auto vblank() -> void;
 
   auto power() -> void;
 
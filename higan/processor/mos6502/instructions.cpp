@@ -1,4 +1,4 @@
-auto MOS6502::instructionAbsoluteModify(fp alu) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionAbsoluteModify() -> void {
   uint16 absolute = operand();
   absolute |= operand() << 8;
   auto data = read(absolute);
@@ -6,7 +6,7 @@ auto MOS6502::instructionAbsoluteModify(fp alu) -> void {
 L write(absolute, ALU(data));
 }
 
-auto MOS6502::instructionAbsoluteModify(fp alu, uint8 index) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionAbsoluteModify(uint8 index) -> void {
   uint16 absolute = operand();
   absolute |= operand() << 8;
   idlePageAlways(absolute, absolute + index);
@@ -15,13 +15,13 @@ auto MOS6502::instructionAbsoluteModify(fp alu, uint8 index) -> void {
 L write(absolute + index, ALU(data));
 }
 
-auto MOS6502::instructionAbsoluteRead(fp alu, uint8& data) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionAbsoluteRead(uint8& data) -> void {
   uint16 absolute = operand();
   absolute |= operand() << 8;
 L data = ALU(read(absolute));
 }
 
-auto MOS6502::instructionAbsoluteRead(fp alu, uint8& data, uint8 index) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionAbsoluteRead(uint8& data, uint8 index) -> void {
   uint16 absolute = operand();
   absolute |= operand() << 8;
   idlePageCrossed(absolute, absolute + index);
@@ -49,6 +49,7 @@ auto MOS6502::instructionBranch(bool take) -> void {
     idlePageCrossed(PC, PC + displacement);
   L idle();
     PC = PC + displacement;
+    if(displacement == -2) idleLoop();
   }
 }
 
@@ -85,16 +86,16 @@ L idle();
   PC--;
 }
 
-auto MOS6502::instructionImmediate(fp alu, uint8& data) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionImmediate(uint8& data) -> void {
 L data = ALU(operand());
 }
 
-auto MOS6502::instructionImplied(fp alu, uint8& data) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionImplied(uint8& data) -> void {
 L idle();
   data = ALU(data);
 }
 
-auto MOS6502::instructionIndirectXRead(fp alu, uint8& data) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionIndirectXRead(uint8& data) -> void {
   auto zeroPage = operand();
   load(zeroPage);
   uint16 absolute = load(zeroPage + X + 0);
@@ -110,7 +111,7 @@ auto MOS6502::instructionIndirectXWrite(uint8& data) -> void {
 L write(absolute, data);
 }
 
-auto MOS6502::instructionIndirectYRead(fp alu, uint8& data) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionIndirectYRead(uint8& data) -> void {
   auto zeroPage = operand();
   uint16 absolute = load(zeroPage + 0);
   absolute |= load(zeroPage + 1) << 8;
@@ -199,14 +200,14 @@ L idle();
   N = target.bit(7);
 }
 
-auto MOS6502::instructionZeroPageModify(fp alu) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionZeroPageModify() -> void {
   auto zeroPage = operand();
   auto data = load(zeroPage);
   store(zeroPage, data);
 L store(zeroPage, ALU(data));
 }
 
-auto MOS6502::instructionZeroPageModify(fp alu, uint8 index) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionZeroPageModify(uint8 index) -> void {
   auto zeroPage = operand();
   load(zeroPage);
   auto data = load(zeroPage + index);
@@ -214,12 +215,12 @@ auto MOS6502::instructionZeroPageModify(fp alu, uint8 index) -> void {
 L store(zeroPage + index, ALU(data));
 }
 
-auto MOS6502::instructionZeroPageRead(fp alu, uint8& data) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionZeroPageRead(uint8& data) -> void {
   auto zeroPage = operand();
 L data = ALU(load(zeroPage));
 }
 
-auto MOS6502::instructionZeroPageRead(fp alu, uint8& data, uint8 index) -> void {
+template<MOS6502::fp alu> auto MOS6502::instructionZeroPageRead(uint8& data, uint8 index) -> void {
   auto zeroPage = operand();
   load(zeroPage);
 L data = ALU(load(zeroPage + index));
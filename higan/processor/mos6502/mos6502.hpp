@@ -10,6 +10,7 @@ struct MOS6502 {
   virtual auto lastCycle() -> void = 0;
   virtual auto nmi(uint16& vector) -> void = 0;
   virtual auto readDebugger(uint16 addr) -> uint8 { return 0; }
+  virtual auto idleLoop() -> void {}  //called after a branch to itself
 
   //mos6502.cpp
   auto mdr() const -> uint8;
@@ -50,10 +51,11 @@ struct MOS6502 {
   auto instruction() -> void;
 
   //instructions.cpp
-  auto instructionAbsoluteModify(fp alu) -> void;
-  auto instructionAbsoluteModify(fp alu, uint8 index) -> void;
-  auto instructionAbsoluteRead(fp alu, uint8& data) -> void;
-  auto instructionAbsoluteRead(fp alu, uint8& data, uint8 index) -> void;
+  //the algorithm is a template parameter so that each opcode gets its own inlined copy
+  template<fp alu> auto instructionAbsoluteModify() -> void;
+  template<fp alu> auto instructionAbsoluteModify(uint8 index) -> void;
+  template<fp alu> auto instructionAbsoluteRead(uint8& data) -> void;
+  template<fp alu> auto instructionAbsoluteRead(uint8& data, uint8 index) -> void;
   auto instructionAbsoluteWrite(uint8& data) -> void;
   auto instructionAbsoluteWrite(uint8& data, uint8 index) -> void;
   auto instructionBranch(bool take) -> void;
@@ -61,11 +63,11 @@ struct MOS6502 {
   auto instructionCallAbsolute() -> void;
   auto instructionClear(bool& flag) -> void;
   auto instructionHalt() -> void;
-  auto instructionImmediate(fp alu, uint8& data) -> void;
-  auto instructionImplied(fp alu, uint8& data) -> void;
-  auto instructionIndirectXRead(fp alu, uint8& data) -> void;
+  template<fp alu> auto instructionImmediate(uint8& data) -> void;
+  template<fp alu> auto instructionImplied(uint8& data) -> void;
+  template<fp alu> auto instructionIndirectXRead(uint8& data) -> void;
   auto instructionIndirectXWrite(uint8& data) -> void;
-  auto instructionIndirectYRead(fp alu, uint8& data) -> void;
+  template<fp alu> auto instructionIndirectYRead(uint8& data) -> void;
   auto instructionIndirectYWrite(uint8& data) -> void;
   auto instructionJumpAbsolute() -> void;
   auto instructionJumpIndirect() -> void;
@@ -78,10 +80,10 @@ struct MOS6502 {
   auto instructionReturnSubroutine() -> void;
   auto instructionSet(bool& flag) -> void;
   auto instructionTransfer(uint8& source, uint8& target, bool flag) -> void;
-  auto instructionZeroPageModify(fp alu) -> void;
-  auto instructionZeroPageModify(fp alu, uint8 index) -> void;
-  auto instructionZeroPageRead(fp alu, uint8& data) -> void;
-  auto instructionZeroPageRead(fp alu, uint8& data, uint8 index) -> void;
+  template<fp alu> auto instructionZeroPageModify() -> void;
+  template<fp alu> auto instructionZeroPageModify(uint8 index) -> void;
+  template<fp alu> auto instructionZeroPageRead(uint8& data) -> void;
+  template<fp alu> auto instructionZeroPageRead(uint8& data, uint8 index) -> void;
   auto instructionZeroPageWrite(uint8& data) -> void;
   auto instructionZeroPageWrite(uint8& data, uint8 index) -> void;
 
@@ -0,0 +1,84 @@
+//batched voice output: with FastDSP, the S-SMP only runs once per sample (during echo27),
+//so every register a voice's output depends on holds the same value from misc30 through
+//voice5 of the following sample. this allows interpolation, noise, envelope and volume to be
+//computed for all eight voices at once, and their sums to be accumulated in voice order
+//ahead of time. the results are identical to the interleaved pipeline in FastDSP mode.
+
+auto DSP::batchVoices() -> void {
+  #if defined(SIMD_AVX2)
+  const int stride = sizeof(Voice) / sizeof(int);
+  const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i voices = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(stride));
+  auto gather = [&](const int& base, __m256i index) -> __m256i {
+    return _mm256_i32gather_epi32(&base, index, 4);
+  };
+
+  __m256i gaussianOffset = gather(voice[0].gaussianOffset, voices);
+  __m256i bufferOffset   = gather(voice[0].bufferOffset, voices);
+  __m256i envelope       = gather(voice[0].envelope, voices);
+  __m256i konDelay       = gather(voice[0].konDelay, voices);
+
+  //gaussian interpolation
+  __m256i offset  = _mm256_and_si256(_mm256_srli_epi32(gaussianOffset, 4), _mm256_set1_epi32(0xff));
+  __m256i forward = _mm256_sub_epi32(_mm256_set1_epi32(255), offset);
+  __m256i sample  = _mm256_add_epi32(voices, _mm256_add_epi32(_mm256_set1_epi32(12),
+                    _mm256_add_epi32(bufferOffset, _mm256_srli_epi32(gaussianOffset, 12))));
+  auto tap = [&](__m256i table, int index) -> __m256i {
+    __m256i coefficient = gather(batch.gaussian[0], table);
+    __m256i data = gather(voice[0].buffer[index], sample);
+    return _mm256_srai_epi32(_mm256_mullo_epi32(coefficient, data), 11);
+  };
+  __m256i output = tap(forward, 0);
+  output = _mm256_add_epi32(output, tap(_mm256_add_epi32(forward, _mm256_set1_epi32(256)), 1));
+  output = _mm256_add_epi32(output, tap(_mm256_add_epi32(offset, _mm256_set1_epi32(256)), 2));
+  output = _mm256_srai_epi32(_mm256_slli_epi32(output, 16), 16);
+  output = _mm256_add_epi32(output, tap(offset, 3));
+  output = _mm256_min_epi32(_mm256_max_epi32(output, _mm256_set1_epi32(-0x8000)), _mm256_set1_epi32(+0x7fff));
+  output = _mm256_and_si256(output, _mm256_set1_epi32(~1));
+
+  //noise
+  const __m256i vbits = _mm256_sllv_epi32(_mm256_set1_epi32(1), lanes);
+  __m256i noise = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(state._non), vbits), vbits);
+  output = _mm256_blendv_epi8(output, _mm256_set1_epi32((int16)(state.noise << 1)), noise);
+
+  //apply envelope (voice3c clears the envelope before output while KON is pending)
+  envelope = _mm256_and_si256(envelope, _mm256_cmpeq_epi32(konDelay, _mm256_setzero_si256()));
+  output = _mm256_srai_epi32(_mm256_mullo_epi32(output, envelope), 11);
+  output = _mm256_and_si256(output, _mm256_set1_epi32(~1));
+  _mm256_storeu_si256((__m256i*)batch.output, output);
+
+  //apply left/right volume
+  __m256i volumeLeft = _mm256_setr_epi32(
+    (int8)REG(0x00), (int8)REG(0x10), (int8)REG(0x20), (int8)REG(0x30),
+    (int8)REG(0x40), (int8)REG(0x50), (int8)REG(0x60), (int8)REG(0x70));
+  __m256i volumeRight = _mm256_setr_epi32(
+    (int8)REG(0x01), (int8)REG(0x11), (int8)REG(0x21), (int8)REG(0x31),
+    (int8)REG(0x41), (int8)REG(0x51), (int8)REG(0x61), (int8)REG(0x71));
+  _mm256_storeu_si256((__m256i*)batch.left,  _mm256_srai_epi32(_mm256_mullo_epi32(output, volumeLeft), 7));
+  _mm256_storeu_si256((__m256i*)batch.right, _mm256_srai_epi32(_mm256_mullo_epi32(output, volumeRight), 7));
+  #else
+  for(auto n : range(8)) {
+    auto& v = voice[n];
+    int output = gaussianInterpolate(v);
+    if(state._non & v.vbit) output = (int16)(state.noise << 1);
+    int envelope = v.konDelay ? 0 : v.envelope;
+    output = ((output * envelope) >> 11) & ~1;
+    batch.output[n] = output;
+    batch.left[n]  = (output * (int8)VREG(VOLL)) >> 7;
+    batch.right[n] = (output * (int8)VREG(VOLR)) >> 7;
+  }
+  #endif
+}
+
+auto DSP::batchMix() -> void {
+  //the sums saturate after every voice, so they are accumulated in voice order
+  for(auto n : range(8)) {
+    if(voiceMute & 1 << n) continue;
+    state._mainOut[0] = sclamp<16>(state._mainOut[0] + batch.left[n]);
+    state._mainOut[1] = sclamp<16>(state._mainOut[1] + batch.right[n]);
+    if(state._eon & 1 << n) {
+      state._echoOut[0] = sclamp<16>(state._echoOut[0] + batch.left[n]);
+      state._echoOut[1] = sclamp<16>(state._echoOut[1] + batch.right[n]);
+    }
+  }
+}
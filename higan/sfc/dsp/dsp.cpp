@@ -8,6 +8,7 @@ DSP dsp;
 #define VREG(n) state.regs[v.vidx + n]
 
 #include "gaussian.cpp"
+#include "batch.cpp"
 #include "counter.cpp"
 #include "envelope.cpp"
 #include "brr.cpp"
@@ -182,8 +183,10 @@ auto DSP::main() -> void {
   tick();
 
   misc30();
+  if(batched) batchVoices();
   voice3c(voice[0]);
   echo30();
+  if(batched) batchMix();
   tick();
 
   voice4(voice[0]);
@@ -244,6 +247,8 @@ auto DSP::load() -> bool {
 
 auto DSP::power(bool reset) -> void {
   create(Enter, system.apuFrequency());
+  batched = system.batchedDSP();
+  for(auto n : range(512)) batch.gaussian[n] = GaussianTable[n];
   stream = Emulator::audio.createStream(2, frequency() / 768.0);
 
   if(!reset) random.array(apuram, sizeof(apuram));
@@ -262,7 +267,7 @@ auto DSP::power(bool reset) -> void {
   REG(ENDX) = 0xff;
 }
 
-auto DSP::loadDump(vector<uint8_t> dspregs) -> void {
+auto DSP::loadDump(array_view<uint8_t> dspregs) -> void {
   for(auto r : range(0x80)) REG(r) = dspregs[r];
 
   // Internal state
@@ -21,7 +21,9 @@ struct DSP : Thread {
 
   auto setRegister(uint8 reg, uint8 data) -> void;
 
-  auto loadDump(vector<uint8_t> dspregs) -> void;
+  auto loadDump(array_view<uint8_t> dspregs) -> void;
+
+  uint8 voiceMute = 0;  //voices left out of the main and echo mix; d0 = voice 0
 
 private:
   enum GlobalRegister : uint {
@@ -58,7 +60,7 @@ private:
   struct State {
     uint8 regs[128];
 
-    int echoHistory[2][8] = {};  //echo history keeps most recent 8 stereo samples
+    int echoHistory[2][16] = {};  //echo history keeps most recent 8 stereo samples (stored twice)
     uint3 echoHistoryOffset;
 
     bool everyOtherSample = 1;  //toggles every sample
@@ -124,6 +126,18 @@ private:
   static const int16 GaussianTable[512];
   auto gaussianInterpolate(const Voice& v) -> int;
 
+  //batch.cpp
+  struct Batch {
+    int gaussian[512];  //GaussianTable widened for 32-bit gathers
+    int output[8];      //enveloped output of each voice, computed once per sample
+    int left[8];        //output after left and right volume
+    int right[8];
+  } batch;
+  bool batched = false;
+
+  auto batchVoices() -> void;
+  auto batchMix() -> void;
+
   //counter.cpp
   static const uint16 CounterRate[32];
   static const uint16 CounterOffset[32];
@@ -162,6 +176,9 @@ private:
   auto echoOutput(bool channel) -> int;
   auto echoRead(bool channel) -> void;
   auto echoWrite(bool channel) -> void;
+  auto echoReadStereo() -> void;
+  auto echoWriteStereo() -> void;
+  auto echoFilter() -> void;
   auto echo22() -> void;
   auto echo23() -> void;
   auto echo24() -> void;
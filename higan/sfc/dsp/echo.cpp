@@ -1,5 +1,5 @@
 auto DSP::calculateFIR(bool channel, int index) -> int {
-  int sample = state.echoHistory[channel][(uint3)(state.echoHistoryOffset + index + 1)];
+  int sample = state.echoHistory[channel][state.echoHistoryOffset + index + 1];
   return (sample * (int8)REG(FIR + index * 0x10)) >> 6;
 }
 
@@ -14,7 +14,8 @@ auto DSP::echoRead(bool channel) -> void {
   uint8 lo = apuram[(uint16)(addr + 0)];
   uint8 hi = apuram[(uint16)(addr + 1)];
   int s = (int16)((hi << 8) + lo);
-  state.echoHistory[channel][state.echoHistoryOffset] = s >> 1;
+  state.echoHistory[channel][state.echoHistoryOffset + 0] = s >> 1;
+  state.echoHistory[channel][state.echoHistoryOffset + 8] = s >> 1;
 }
 
 auto DSP::echoWrite(bool channel) -> void {
@@ -28,11 +29,88 @@ auto DSP::echoWrite(bool channel) -> void {
   state._echoOut[channel] = 0;
 }
 
+//batched mode: nothing can change the FIR registers or echo memory between echo22 and echo30
+//except the DSP itself, so both channels are read and filtered at echo22 and written at echo29
+
+auto DSP::echoReadStereo() -> void {
+  uint16 addr = state._echoPointer;
+  #if defined(ENDIAN_LSB)
+  if(addr <= 0xfffc) {
+    int16_t s[2];
+    memory::copy(s, &apuram[addr], 4);
+    state.echoHistory[0][state.echoHistoryOffset + 0] = s[0] >> 1;
+    state.echoHistory[0][state.echoHistoryOffset + 8] = s[0] >> 1;
+    state.echoHistory[1][state.echoHistoryOffset + 0] = s[1] >> 1;
+    state.echoHistory[1][state.echoHistoryOffset + 8] = s[1] >> 1;
+    return;
+  }
+  #endif
+  echoRead(0);
+  echoRead(1);
+}
+
+auto DSP::echoWriteStereo() -> void {
+  uint16 addr = state._echoPointer;
+  #if defined(ENDIAN_LSB)
+  if(addr <= 0xfffc) {
+    if(!(state._echoDisabled & 0x20)) {
+      int16_t s[2] = {(int16_t)state._echoOut[0], (int16_t)state._echoOut[1]};
+      memory::copy(&apuram[addr], s, 4);
+    }
+    state._echoOut[0] = 0;
+    state._echoOut[1] = 0;
+    return;
+  }
+  #endif
+  echoWrite(0);
+  echoWrite(1);
+}
+
+auto DSP::echoFilter() -> void {
+  //the eight taps are contiguous in the duplicated history, oldest sample first
+  const int* history[2] = {
+    &state.echoHistory[0][state.echoHistoryOffset + 1],
+    &state.echoHistory[1][state.echoHistoryOffset + 1],
+  };
+  int sum[2], last[2];
+
+  #if defined(SIMD_AVX2)
+  __m256i coefficients = _mm256_setr_epi32(
+    (int8)REG(FIR + 0x00), (int8)REG(FIR + 0x10), (int8)REG(FIR + 0x20), (int8)REG(FIR + 0x30),
+    (int8)REG(FIR + 0x40), (int8)REG(FIR + 0x50), (int8)REG(FIR + 0x60), (int8)REG(FIR + 0x70));
+  __m256i l = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)history[0]), coefficients), 6);
+  __m256i r = _mm256_srai_epi32(_mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)history[1]), coefficients), 6);
+  last[0] = _mm256_extract_epi32(l, 7);
+  last[1] = _mm256_extract_epi32(r, 7);
+
+  //sum the first seven taps of both channels
+  __m256i taps = _mm256_hadd_epi32(_mm256_blend_epi32(l, _mm256_setzero_si256(), 0x80),
+                                   _mm256_blend_epi32(r, _mm256_setzero_si256(), 0x80));
+  taps = _mm256_hadd_epi32(taps, taps);
+  __m128i sums = _mm_add_epi32(_mm256_castsi256_si128(taps), _mm256_extracti128_si256(taps, 1));
+  sum[0] = _mm_extract_epi32(sums, 0);
+  sum[1] = _mm_extract_epi32(sums, 1);
+  #else
+  for(auto channel : range(2)) {
+    sum[channel] = 0;
+    for(auto index : range(7)) sum[channel] += (history[channel][index] * (int8)REG(FIR + index * 0x10)) >> 6;
+    last[channel] = (history[channel][7] * (int8)REG(FIR + 0x70)) >> 6;
+  }
+  #endif
+
+  for(auto channel : range(2)) {
+    int s = (int16)sum[channel];
+    s += (int16)last[channel];
+    state._echoIn[channel] = sclamp<16>(s) & ~1;
+  }
+}
+
 auto DSP::echo22() -> void {
   //history
   state.echoHistoryOffset++;
 
   state._echoPointer = (uint16)((state._esa << 8) + state.echoOffset);
+  if(batched) return echoReadStereo(), echoFilter();
   echoRead(0);
 
   //FIR
@@ -44,6 +122,7 @@ auto DSP::echo22() -> void {
 }
 
 auto DSP::echo23() -> void {
+  if(batched) return;  //filtered by echo22
   int l = calculateFIR(0, 1) + calculateFIR(0, 2);
   int r = calculateFIR(1, 1) + calculateFIR(1, 2);
 
@@ -54,6 +133,7 @@ auto DSP::echo23() -> void {
 }
 
 auto DSP::echo24() -> void {
+  if(batched) return;  //filtered by echo22
   int l = calculateFIR(0, 3) + calculateFIR(0, 4) + calculateFIR(0, 5);
   int r = calculateFIR(1, 3) + calculateFIR(1, 4) + calculateFIR(1, 5);
 
@@ -62,6 +142,7 @@ auto DSP::echo24() -> void {
 }
 
 auto DSP::echo25() -> void {
+  if(batched) return;  //filtered by echo22
   int l = state._echoIn[0] + calculateFIR(0, 6);
   int r = state._echoIn[1] + calculateFIR(1, 6);
 
@@ -119,12 +200,13 @@ auto DSP::echo29() -> void {
   if(state.echoOffset >= state.echoLength) state.echoOffset = 0;
 
   //write left echo
-  echoWrite(0);
+  if(batched) echoWriteStereo();
+  else echoWrite(0);
 
   state._echoDisabled = REG(FLG);
 }
 
 auto DSP::echo30() -> void {
   //write right echo
-  echoWrite(1);
+  if(!batched) echoWrite(1);
 }
@@ -4,6 +4,7 @@ void DSP::serialize(serializer& s) {
   s.array(apuram);
 
   s.array(state.regs, 128);
+  s.array(batch.output);
   s.array(state.echoHistory[0]);
   s.array(state.echoHistory[1]);
   s.integer(state.echoHistoryOffset);
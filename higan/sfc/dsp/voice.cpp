@@ -1,4 +1,6 @@
 inline auto DSP::voiceOutput(Voice& v, bool channel) -> void {
+  if(voiceMute & v.vbit) return;
+
   //apply left/right volume
   int amp = (state._output * (int8)VREG(VOLL + channel)) >> 7;
 
@@ -76,16 +78,21 @@ auto DSP::voice3c(Voice& v) -> void {
     state._pitch = 0;
   }
 
-  //gaussian interpolation
-  int output = gaussianInterpolate(v);
+  if(batched) {
+    //interpolation, noise and envelope were applied to all voices by batchVoices()
+    state._output = batch.output[v.vidx >> 4];
+  } else {
+    //gaussian interpolation
+    int output = gaussianInterpolate(v);
 
-  //noise
-  if(state._non & v.vbit) {
-    output = (int16)(state.noise << 1);
-  }
+    //noise
+    if(state._non & v.vbit) {
+      output = (int16)(state.noise << 1);
+    }
 
-  //apply envelope
-  state._output = ((output * v.envelope) >> 11) & ~1;
+    //apply envelope
+    state._output = ((output * v.envelope) >> 11) & ~1;
+  }
   v._envxOut = v.envelope >> 4;
 
   //immediate silence due to end of sample or soft reset
@@ -135,12 +142,12 @@ auto DSP::voice4(Voice& v) -> void {
   if(v.gaussianOffset > 0x7fff) v.gaussianOffset = 0x7fff;
 
   //output left
-  voiceOutput(v, 0);
+  if(!batched) voiceOutput(v, 0);
 }
 
 auto DSP::voice5(Voice& v) -> void {
   //output right
-  voiceOutput(v, 1);
+  if(!batched) voiceOutput(v, 1);
 
   //ENDX, OUTX and ENVX won't update if you wrote to them 1-2 clocks earlier
   state.endxBuffer = REG(ENDX) | state._looped;
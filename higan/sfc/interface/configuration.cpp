@@ -12,6 +12,7 @@ auto Configuration::process(Markup::Node document, bool load) -> void {
   bind(natural, "System/PPU1/Version", system.ppu1.version);
   bind(natural, "System/PPU1/VRAM/Size", system.ppu1.vram.size);
   bind(natural, "System/PPU2/Version", system.ppu2.version);
+  bind(boolean, "System/APUOnly", system.apuOnly);
 
   bind(boolean, "Video/BlurEmulation", video.blurEmulation);
   bind(boolean, "Video/ColorEmulation", video.colorEmulation);
@@ -20,6 +21,7 @@ auto Configuration::process(Markup::Node document, bool load) -> void {
   bind(boolean, "Hacks/FastPPU/NoSpriteLimit", hacks.ppuFast.noSpriteLimit);
   bind(boolean, "Hacks/FastPPU/HiresMode7", hacks.ppuFast.hiresMode7);
   bind(boolean, "Hacks/FastDSP/Enable", hacks.dspFast.enable);
+  bind(boolean, "Hacks/FastDSP/Batched", hacks.dspFast.batched);
   bind(boolean, "Hacks/Coprocessors/DelayedSync", hacks.coprocessors.delayedSync);
 
   #undef bind
@@ -17,6 +17,7 @@ struct Configuration {
     struct PPU2 {
       uint version = 3;
     } ppu2;
+    bool apuOnly = false;
   } system;
 
   struct Video {
@@ -32,6 +33,7 @@ struct Configuration {
     } ppuFast;
     struct DSPFast {
       bool enable = false;
+      bool batched = false;
     } dspFast;
     struct Coprocessors {
       bool delayedSync = false;
@@ -31,19 +31,19 @@ auto SMP::readIO(uint16 address) -> uint8 {
     return dsp.read(io.dspAddr & 0x7f);
 
   case 0xf4:  //CPUIO0
-    if (!cpu.disabled) synchronize(cpu);
+    synchronize(cpu);
     return io.apu0;
 
   case 0xf5:  //CPUIO1
-    if (!cpu.disabled) synchronize(cpu);
+    synchronize(cpu);
     return io.apu1;
 
   case 0xf6:  //CPUIO2
-    if (!cpu.disabled) synchronize(cpu);
+    synchronize(cpu);
     return io.apu2;
 
   case 0xf7:  //CPUIO3
-    if (!cpu.disabled) synchronize(cpu);
+    synchronize(cpu);
     return io.apu3;
 
   case 0xf8:  //AUXIO4
@@ -91,6 +91,7 @@ auto SMP::writeIO(uint16 address, uint8 data) -> void {
     timer0.synchronizeStage1();
     timer1.synchronizeStage1();
     timer2.synchronizeStage1();
+    updateFast();
     break;
 
   case 0xf1:  //CONTROL
@@ -111,18 +112,19 @@ auto SMP::writeIO(uint16 address, uint8 data) -> void {
     }
 
     if(data.bit(4)) {
-      if (!cpu.disabled) synchronize(cpu);
+      synchronize(cpu);
       io.apu0 = 0x00;
       io.apu1 = 0x00;
     }
 
     if(data.bit(5)) {
-      if (!cpu.disabled) synchronize(cpu);
+      synchronize(cpu);
       io.apu2 = 0x00;
       io.apu3 = 0x00;
     }
 
     io.iplromEnable = data.bit(7);
+    updateFast();
     break;
 
   case 0xf2:  //DSPADDR
@@ -135,22 +137,22 @@ auto SMP::writeIO(uint16 address, uint8 data) -> void {
     break;
 
   case 0xf4:  //CPUIO0
-    if (!cpu.disabled) synchronize(cpu);
+    synchronize(cpu);
     io.cpu0 = data;
     break;
 
   case 0xf5:  //CPUIO1
-    if (!cpu.disabled) synchronize(cpu);
+    synchronize(cpu);
     io.cpu1 = data;
     break;
 
   case 0xf6:  //CPUIO2
-    if (!cpu.disabled) synchronize(cpu);
+    synchronize(cpu);
     io.cpu2 = data;
     break;
 
   case 0xf7:  //CPUIO3
-    if (!cpu.disabled) synchronize(cpu);
+    synchronize(cpu);
     io.cpu3 = data;
     break;
 
@@ -181,7 +183,7 @@ auto SMP::writeIO(uint16 address, uint8 data) -> void {
   }
 }
 
-auto SMP::loadDump(vector<uint8_t> dspram, vector<uint8_t> dspregs) -> void {
+auto SMP::loadDump(array_view<uint8_t> dspram, array_view<uint8_t> dspregs) -> void {
   // Load DSP RAM and regs:
   for (auto n : range(dspram.size())) {
     const uint16 address = n;
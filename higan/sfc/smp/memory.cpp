@@ -1,3 +1,21 @@
+//most accesses are to plain RAM at the external wait state; they skip the region checks
+//and wait state lookups below. the tables only depend on $00f0 and $00f1, so they are
+//rebuilt whenever those are written
+
+auto SMP::updateFast() -> void {
+  for(uint page : range(256)) {
+    bool plain = !io.ramDisable;
+    if(page == 0x00) plain = false;  //I/O registers
+    if(page == 0xff && io.iplromEnable) plain = false;
+    fast.read[page] = plain ? &dsp.apuram[page << 8] : nullptr;
+    fast.write[page] = plain && io.ramWritable ? &dsp.apuram[page << 8] : nullptr;
+  }
+  fast.cycles = cycleWaitStates[io.externalWaitStates];
+  fast.timerCycles = timerWaitStates[io.externalWaitStates];
+  fast.idleCycles = cycleWaitStates[io.internalWaitStates];
+  fast.idleTimerCycles = timerWaitStates[io.internalWaitStates];
+}
+
 auto SMP::readRAM(uint16 address) -> uint8 {
   if(address >= 0xffc0 && io.iplromEnable) return iplrom[address & 0x3f];
   if(io.ramDisable) return 0x5a;  //0xff on mini-SNES
@@ -10,10 +28,17 @@ auto SMP::writeRAM(uint16 address, uint8 data) -> void {
 }
 
 auto SMP::idle() -> void {
-  wait();
+  step(fast.idleCycles);
+  stepTimers(fast.idleTimerCycles);
 }
 
 auto SMP::read(uint16 address) -> uint8 {
+  if(auto page = fast.read[address >> 8]) {
+    step(fast.cycles);
+    stepTimers(fast.timerCycles);
+    return page[(uint8)address];
+  }
+
   wait(address);
   uint8 data = readRAM(address);
   if((address & 0xfff0) == 0x00f0) data = readIO(address);
@@ -21,6 +46,13 @@ auto SMP::read(uint16 address) -> uint8 {
 }
 
 auto SMP::write(uint16 address, uint8 data) -> void {
+  if(fast.write[address >> 8]) {
+    step(fast.cycles);
+    stepTimers(fast.timerCycles);
+    dsp.apuram[address] = data;
+    return;
+  }
+
   wait(address);
   writeRAM(address, data);  //even IO writes affect underlying RAM
   if((address & 0xfff0) == 0x00f0) writeIO(address, data);
@@ -52,4 +52,6 @@ auto SMP::serialize(serializer& s) -> void {
   s.boolean(timer2.line);
   s.boolean(timer2.enable);
   s.integer(timer2.target);
+
+  updateFast();
 }
@@ -15,6 +15,7 @@ auto SMP::Enter() -> void {
 auto SMP::main() -> void {
   if(r.wait) return instructionWait();
   if(r.stop) return instructionStop();
+  skipTimerPoll();
   instruction();
 }
 
@@ -37,6 +38,7 @@ auto SMP::power(bool reset) -> void {
   timer0 = {};
   timer1 = {};
   timer2 = {};
+  updateFast();
 }
 
 }
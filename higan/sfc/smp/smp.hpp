@@ -18,7 +18,7 @@ struct SMP : Processor::SPC700, Thread {
 
   uint8 iplrom[64];
 
-  auto loadDump(vector<uint8_t> dspram, vector<uint8_t> dspregs) -> void;
+  auto loadDump(array_view<uint8_t> dspram, array_view<uint8_t> dspregs) -> void;
 
 private:
   struct IO {
@@ -58,6 +58,16 @@ private:
   } io;
 
   //memory.cpp
+  struct Fast {
+    uint8* read[256];   //plain RAM pages; null where the IPLROM, I/O registers or RAM disable need the full path
+    uint8* write[256];
+    uint cycles;        //wait states of external accesses
+    uint timerCycles;
+    uint idleCycles;    //wait states of internal cycles
+    uint idleTimerCycles;
+  } fast;
+
+  auto updateFast() -> void;
   inline auto readRAM(uint16 address) -> uint8;
   inline auto writeRAM(uint16 address, uint8 data) -> void;
 
@@ -90,9 +100,13 @@ private:
   Timer<128> timer1;
   Timer< 16> timer2;
 
+  static const uint cycleWaitStates[4];
+  static const uint timerWaitStates[4];
+
   inline auto wait(maybe<uint16> address = nothing) -> void;
   inline auto step(uint clocks) -> void;
   inline auto stepTimers(uint clocks) -> void;
+  auto skipTimerPoll() -> void;
 };
 
 extern SMP smp;
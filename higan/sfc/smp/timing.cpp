@@ -6,10 +6,10 @@
 //sometimes the SMP will run far slower than expected
 //other times (and more likely), the SMP will deadlock until the system is reset
 //the timers are not affected by this and advance by their expected values
-auto SMP::wait(maybe<uint16> addr) -> void {
-  static const uint cycleWaitStates[4] = {2, 4, 10, 20};
-  static const uint timerWaitStates[4] = {2, 4,  8, 16};
+const uint SMP::cycleWaitStates[4] = {2, 4, 10, 20};
+const uint SMP::timerWaitStates[4] = {2, 4,  8, 16};
 
+auto SMP::wait(maybe<uint16> addr) -> void {
   uint waitStates = io.externalWaitStates;
   if(!addr) waitStates = io.internalWaitStates;  //idle cycles
   else if((*addr & 0xfff0) == 0x00f0) waitStates = io.internalWaitStates;  //IO registers
@@ -23,12 +23,13 @@ auto SMP::step(uint clocks) -> void {
   Thread::step(clocks);
   synchronize(dsp);
 
+  //in APU-only mode the S-CPU clock is parked at its maximum, so neither sync below resumes it
   #if defined(DEBUGGER)
-  if (!cpu.disabled) synchronize(cpu);
+  synchronize(cpu);
   #else
   //forcefully sync S-SMP to S-CPU in case chips are not communicating
   //sync if S-SMP is more than 1ms ahead of S-CPU
-  if (!cpu.disabled) if(clock() - cpu.clock() > Thread::Second / 1'000) synchronize(cpu);
+  if(clock() - cpu.clock() > Thread::Second / 1'000) synchronize(cpu);
   #endif
 }
 
@@ -38,6 +39,70 @@ auto SMP::stepTimers(uint clocks) -> void {
   timer2.step(clocks);
 }
 
+//sound drivers wait for a timer by polling its output until it reads non-zero:
+//  mov reg,$fd-$ff : beq -4  or  mov reg,!$00fd-$00ff : beq -5
+//while the output reads zero, each iteration repeats the same accesses without side effects,
+//so whole iterations are consumed here by stepping the clock and timers directly.
+//the iteration that observes the timer is left to the interpreter
+auto SMP::skipTimerPoll() -> void {
+  if(r.p.p) return;  //direct page must be $00xx
+  if((uint8)r.pc.w > 0xfb) return;  //loop must not cross a page
+  auto code = fast.read[r.pc.w >> 8];
+  if(!code) return;
+  code += (uint8)r.pc.w;
+
+  uint length = 2;
+  uint8* target = nullptr;
+  switch(code[0]) {
+  case 0xe5: length = 3;
+  case 0xe4: target = &r.ya.byte.l; break;
+  case 0xe9: length = 3;
+  case 0xf8: target = &r.x; break;
+  case 0xec: length = 3;
+  case 0xeb: target = &r.ya.byte.h; break;
+  default: return;
+  }
+  if(code[1] < 0xfd || (length == 3 && code[2])) return;
+  if(code[length] != 0xf0 || (int8)code[length + 1] != -(int)(length + 2)) return;
+
+  auto t0 = timer0;
+  auto t1 = timer1;
+  auto t2 = timer2;
+  auto& output = code[1] == 0xfd ? t0.stage3 : code[1] == 0xfe ? t1.stage3 : t2.stage3;
+  if(output) return;
+
+  auto access = [&](uint clocks) {
+    t0.step(clocks);
+    t1.step(clocks);
+    t2.step(clocks);
+  };
+
+  //bounded so that the S-SMP does not run too far ahead of the other threads
+  uint iterations = 0;
+  while(iterations < 64) {
+    auto s0 = t0;
+    auto s1 = t1;
+    auto s2 = t2;
+    for(uint n : range(length)) access(fast.timerCycles);  //opcode and operand fetches
+    access(fast.idleTimerCycles);  //timer output read
+    if(output) { t0 = s0, t1 = s1, t2 = s2; break; }
+    access(fast.timerCycles);  //branch opcode and displacement fetches
+    access(fast.timerCycles);
+    access(fast.idleTimerCycles);
+    access(fast.idleTimerCycles);
+    iterations++;
+  }
+  if(!iterations) return;
+
+  timer0 = t0;
+  timer1 = t1;
+  timer2 = t2;
+  *target = 0;
+  r.p.z = 1;
+  r.p.n = 0;
+  step(iterations * ((length + 2) * fast.cycles + 3 * fast.idleCycles));
+}
+
 template<uint Frequency> auto SMP::Timer<Frequency>::step(uint clocks) -> void {
   //stage 0 increment
   stage0 += clocks;
@@ -12,6 +12,7 @@ auto System::serialize() -> serializer {
 
   s.boolean(hacks.fastPPU);
   s.boolean(hacks.fastDSP);
+  s.boolean(hacks.batchedDSP);
 
   serializeAll(s);
   return s;
@@ -31,6 +32,7 @@ auto System::unserialize(serializer& s) -> bool {
 
   s.boolean(hacks.fastPPU);
   s.boolean(hacks.fastDSP);
+  s.boolean(hacks.batchedDSP);
 
   power(/* reset = */ false);
   serializeAll(s);
@@ -46,10 +48,16 @@ auto System::serialize(serializer& s) -> void {
 auto System::serializeAll(serializer& s) -> void {
   system.serialize(s);
   random.serialize(s);
+  if(apuOnly()) {
+    smp.serialize(s);
+    dsp.serialize(s);
+    return;
+  }
+
   cartridge.serialize(s);
-  if (!cpu.disabled) cpu.serialize(s);
+  cpu.serialize(s);
   smp.serialize(s);
-  if (!ppu.disabled) ppu.serialize(s);
+  ppu.serialize(s);
   dsp.serialize(s);
 
   if(cartridge.has.ICD) icd.serialize(s);
@@ -93,6 +101,7 @@ auto System::serializeInit() -> void {
 
   s.boolean(hacks.fastPPU);
   s.boolean(hacks.fastDSP);
+  s.boolean(hacks.batchedDSP);
 
   serializeAll(s);
   serializeSize = s.size();
@@ -9,29 +9,44 @@ Cheat cheat;
 #include "serialization.cpp"
 
 auto System::run() -> void {
-  if(scheduler.enter() == Scheduler::Event::Frame) if (!ppu.disabled) ppu.refresh();
+  if(scheduler.enter() == Scheduler::Event::Frame) ppu.refresh();
 }
 
 auto System::runToSave() -> void {
-  if (!cpu.disabled) scheduler.synchronize(cpu);
+  if(apuOnly()) {
+    scheduler.synchronize(smp);
+    scheduler.synchronize(dsp);
+    return;
+  }
+
+  scheduler.synchronize(cpu);
   scheduler.synchronize(smp);
-  if (!ppu.disabled) scheduler.synchronize(ppu);
+  scheduler.synchronize(ppu);
   scheduler.synchronize(dsp);
-  if (!cpu.disabled) {
-    for(auto coprocessor : cpu.coprocessors) scheduler.synchronize(*coprocessor);
-    for(auto peripheral : cpu.peripherals) scheduler.synchronize(*peripheral);
-  }
+  for(auto coprocessor : cpu.coprocessors) scheduler.synchronize(*coprocessor);
+  for(auto peripheral : cpu.peripherals) scheduler.synchronize(*peripheral);
 }
 
 auto System::load(Emulator::Interface* interface) -> bool {
   information = {};
   hacks.fastPPU = configuration.hacks.ppuFast.enable;
   hacks.fastDSP = configuration.hacks.dspFast.enable;
+  hacks.batchedDSP = configuration.hacks.dspFast.batched;
+  information.apuOnly = configuration.system.apuOnly;
+
+  //APU-only: no cartridge, bus or video; the caller loads S-SMP and S-DSP state after power()
+  if(apuOnly()) {
+    if(!smp.load()) return false;
+    if(!dsp.load()) return false;
+    serializeInit();
+    this->interface = interface;
+    return information.loaded = true;
+  }
 
   bus.reset();
-  if (!cpu.disabled) if(!cpu.load()) return false;
+  if(!cpu.load()) return false;
   if(!smp.load()) return false;
-  if (!ppu.disabled) if(!ppu.load()) return false;
+  if(!ppu.load()) return false;
   if(!dsp.load()) return false;
   if(!cartridge.load()) return false;
 
@@ -60,8 +75,12 @@ auto System::save() -> void {
 
 auto System::unload() -> void {
   if(!loaded()) return;
+  if(apuOnly()) {
+    information.loaded = false;
+    return;
+  }
 
-  if (!cpu.disabled) cpu.peripherals.reset();
+  cpu.peripherals.reset();
   controllerPort1.unload();
   controllerPort2.unload();
   expansionPort.unload();
@@ -85,6 +104,20 @@ auto System::unload() -> void {
 }
 
 auto System::power(bool reset) -> void {
+  if(apuOnly()) {
+    Emulator::audio.reset(interface);
+    random.entropy(Random::Entropy::Low);
+
+    scheduler.reset();
+    smp.power(reset);
+    dsp.power(reset);
+    scheduler.primary(smp);
+
+    //there is no S-CPU thread: park its clock so that the S-SMP never waits on it
+    cpu.setClock(~(uintmax)0);
+    return;
+  }
+
   Emulator::video.reset(interface);
   Emulator::video.setPalette();
 
@@ -93,10 +126,10 @@ auto System::power(bool reset) -> void {
   random.entropy(Random::Entropy::Low);
 
   scheduler.reset();
-  if (!cpu.disabled) cpu.power(reset);
+  cpu.power(reset);
   smp.power(reset);
   dsp.power(reset);
-  if (!ppu.disabled) ppu.power(reset);
+  ppu.power(reset);
 
   if(cartridge.has.ICD) icd.power();
   if(cartridge.has.MCC) mcc.power();
@@ -117,32 +150,28 @@ auto System::power(bool reset) -> void {
   if(cartridge.has.SufamiTurboSlotA) sufamiturboA.power();
   if(cartridge.has.SufamiTurboSlotB) sufamiturboB.power();
 
-  if (!cpu.disabled) {
-    if(cartridge.has.ICD) cpu.coprocessors.append(&icd);
-    if(cartridge.has.Event) cpu.coprocessors.append(&event);
-    if(cartridge.has.SA1) cpu.coprocessors.append(&sa1);
-    if(cartridge.has.SuperFX) cpu.coprocessors.append(&superfx);
-    if(cartridge.has.ARMDSP) cpu.coprocessors.append(&armdsp);
-    if(cartridge.has.HitachiDSP) cpu.coprocessors.append(&hitachidsp);
-    if(cartridge.has.NECDSP) cpu.coprocessors.append(&necdsp);
-    if(cartridge.has.EpsonRTC) cpu.coprocessors.append(&epsonrtc);
-    if(cartridge.has.SharpRTC) cpu.coprocessors.append(&sharprtc);
-    if(cartridge.has.SPC7110) cpu.coprocessors.append(&spc7110);
-    if(cartridge.has.MSU1) cpu.coprocessors.append(&msu1);
-    if(cartridge.has.BSMemorySlot) cpu.coprocessors.append(&bsmemory);
-
-    scheduler.primary(cpu);
-
-    controllerPort1.power(ID::Port::Controller1);
-    controllerPort2.power(ID::Port::Controller2);
-    expansionPort.power();
-
-    controllerPort1.connect(settings.controllerPort1);
-    controllerPort2.connect(settings.controllerPort2);
-    expansionPort.connect(settings.expansionPort);
-  } else {
-    scheduler.primary(smp);
-  }
+  if(cartridge.has.ICD) cpu.coprocessors.append(&icd);
+  if(cartridge.has.Event) cpu.coprocessors.append(&event);
+  if(cartridge.has.SA1) cpu.coprocessors.append(&sa1);
+  if(cartridge.has.SuperFX) cpu.coprocessors.append(&superfx);
+  if(cartridge.has.ARMDSP) cpu.coprocessors.append(&armdsp);
+  if(cartridge.has.HitachiDSP) cpu.coprocessors.append(&hitachidsp);
+  if(cartridge.has.NECDSP) cpu.coprocessors.append(&necdsp);
+  if(cartridge.has.EpsonRTC) cpu.coprocessors.append(&epsonrtc);
+  if(cartridge.has.SharpRTC) cpu.coprocessors.append(&sharprtc);
+  if(cartridge.has.SPC7110) cpu.coprocessors.append(&spc7110);
+  if(cartridge.has.MSU1) cpu.coprocessors.append(&msu1);
+  if(cartridge.has.BSMemorySlot) cpu.coprocessors.append(&bsmemory);
+
+  scheduler.primary(cpu);
+
+  controllerPort1.power(ID::Port::Controller1);
+  controllerPort2.power(ID::Port::Controller2);
+  expansionPort.power();
+
+  controllerPort1.connect(settings.controllerPort1);
+  controllerPort2.connect(settings.controllerPort2);
+  expansionPort.connect(settings.expansionPort);
 }
 
 }
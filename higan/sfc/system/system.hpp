@@ -5,9 +5,11 @@ struct System {
   inline auto region() const -> Region { return information.region; }
   inline auto cpuFrequency() const -> double { return information.cpuFrequency; }
   inline auto apuFrequency() const -> double { return information.apuFrequency; }
+  inline auto apuOnly() const -> bool { return information.apuOnly; }
 
   inline auto fastPPU() const -> bool { return hacks.fastPPU; }
   inline auto fastDSP() const -> bool { return hacks.fastDSP; }
+  inline auto batchedDSP() const -> bool { return hacks.fastDSP && hacks.batchedDSP; }
 
   auto run() -> void;
   auto runToSave() -> void;
@@ -26,6 +28,7 @@ private:
 
   struct Information {
     bool loaded = false;
+    bool apuOnly = false;  //only the S-SMP and S-DSP exist; their state is loaded directly
     Region region = Region::NTSC;
     double cpuFrequency = Emulator::Constants::Colorburst::NTSC * 6.0;
     double apuFrequency = 32040.0 * 768.0;
@@ -34,6 +37,7 @@ private:
   struct Hacks {
     bool fastPPU = false;
     bool fastDSP = false;
+    bool batchedDSP = false;
   } hacks;
 
   uint serializeSize = 0;
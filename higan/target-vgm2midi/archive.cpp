@@ -0,0 +1,132 @@
+#include <nall/decode/gzip.hpp>
+#include <nall/decode/zip.hpp>
+
+// Input files, mapped into memory; from disk, or straight out of a zip archive when
+// addressed as "game.zip:track.spc". gzip-compressed files (.vgz, .spcz) are decompressed as read:
+struct Archive {
+	static auto isArchive(const string& filename) -> bool;
+
+	// The file in place; mapped from disk, or within the archive's own mapping when stored
+	// uncompressed. Only compressed files are copied out. It is valid until the next call:
+	auto map(const string& location) -> array_view<uint8_t>;
+
+	// A copy of the file, for callers that keep it across other reads:
+	auto read(const string& location) -> vector<uint8_t>;
+
+	// A read-only file over map():
+	auto open(const string& location) -> vfs::shared::file;
+
+	// Files beside another, in the same directory or archive; such as a GSF's _lib:
+	auto sibling(const string& location, const string& name) -> string;
+
+	// Members of an archive, in archive order, as locations:
+	auto members(const string& filename) -> vector<string>;
+
+private:
+	auto split(const string& location, string& filename, string& member) -> bool;
+	auto load(const string& filename) -> bool;
+
+	// The archive last opened; batch mode reads every track out of the one mapping:
+	string filename;
+	Decode::ZIP zip;
+
+	// The plain file last mapped, and the last file decompressed:
+	file_map input;
+	vector<uint8_t> buffer;
+};
+
+Archive archive;
+
+auto Archive::isArchive(const string& filename) -> bool {
+	return string{filename}.downcase().endsWith(".zip");
+}
+
+auto Archive::split(const string& location, string& filename, string& member) -> bool {
+	// The first ".zip:" ends the archive name; member names may hold further colons:
+	auto separator = string{location}.downcase().find(".zip:");
+	if (!separator) return false;
+	filename = slice(location, 0, *separator + 4);
+	member = slice(location, *separator + 5);
+	return true;
+}
+
+auto Archive::load(const string& filename) -> bool {
+	if (filename == this->filename) return true;
+	this->filename = "";
+	if (!zip.open(filename)) {
+		print("Failed to open archive ", filename, "\n");
+		return false;
+	}
+	this->filename = filename;
+	return true;
+}
+
+auto Archive::map(const string& location) -> array_view<uint8_t> {
+	array_view<uint8_t> data;
+	string filename, member;
+	if (split(location, filename, member)) {
+		if (!load(filename)) return {};
+		bool found = false;
+		for (auto& file : zip.file) {
+			if (file.name != member) continue;
+			if (file.cmode == 0) {
+				data = {file.data, file.size};
+			} else {
+				buffer = zip.extract(file);
+				data = buffer;
+			}
+			found = true;
+			break;
+		}
+		if (!found) print("Missing ", member, " in ", filename, "\n");
+	} else {
+		input.close();
+		if (input.open(location, file_map::mode::read)) data = {input.data(), input.size()};
+		else print("Failed to read ", location, "\n");
+	}
+
+	if (data.size() >= 2 && data[0] == 0x1f && data[1] == 0x8b) {
+		// gzip; decompressed in place of the original:
+		Decode::GZIP gzip;
+		if (!gzip.decompress(data.data(), data.size())) {
+			print("Failed to decompress ", location, "\n");
+			return {};
+		}
+		buffer.resize(gzip.size);
+		memory::copy(buffer.data(), gzip.data, gzip.size);
+		data = buffer;
+	}
+	return data;
+}
+
+auto Archive::read(const string& location) -> vector<uint8_t> {
+	vector<uint8_t> data;
+	if (auto view = map(location)) {
+		data.resize(view.size());
+		memory::copy(data.data(), view.data(), view.size());
+	}
+	return data;
+}
+
+auto Archive::open(const string& location) -> vfs::shared::file {
+	auto data = map(location);
+	if (!data) return {};
+	return vfs::memory::file::view(data.data(), data.size());
+}
+
+auto Archive::sibling(const string& location, const string& name) -> string {
+	string filename, member;
+	if (split(location, filename, member)) return {filename, ":", Location::path(member), name};
+	return {Location::path(location), name};
+}
+
+auto Archive::members(const string& filename) -> vector<string> {
+	vector<string> locations;
+	if (!load(filename)) return locations;
+	for (auto& file : zip.file) {
+		// Directories are listed as empty members ending with a slash:
+		if (file.name.endsWith("/")) continue;
+		locations.append({filename, ":", file.name});
+	}
+	return locations;
+}
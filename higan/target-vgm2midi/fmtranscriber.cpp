@@ -0,0 +1,252 @@
+// YM2612 register-to-MIDI transcriber:
+// Keeps its own copy of the registers, so it needs only the register writes and their times;
+// no FM synthesis is involved. FM channels 1-6 become MIDI channels 1-6.
+struct FMTranscriber {
+	// Fingerprint of everything that shapes a channel's timbre; carrier total levels are left out,
+	// since they only set the loudness:
+	struct Patch {
+		uint8_t data[30];  // algorithm/feedback, AMS/FMS, then DT/MUL, TL, KS/AR, AM/D1R, D2R, SL/RR, SSG-EG per operator
+		uint program = 0;
+
+		auto hash() const -> uint { return Hash::CRC32({data, sizeof(data)}).value(); }
+		auto operator==(const Patch& source) const -> bool { return !memory::compare(data, source.data, sizeof(data)); }
+	};
+
+	// Patches by fingerprint, and in order of first use; programs are assigned in that order:
+	hashset<Patch> patchTable;
+	vector<Patch> patches;
+
+	MIDI midi;
+	double clock = 7670453.0;  // YM2612 input clock
+
+	auto write(uint32_t time, uint9 address, uint8_t data) -> void;
+	auto finish(uint32_t time) -> void;
+	auto exportPatches(string filename) -> void;
+
+private:
+	uint8_t regs[2][256] = {};
+	uint8_t pitchLatch[2][4] = {};  // $A4-$A6 writes take effect on the following $A0-$A2 write
+	bool dac = false;
+
+	struct Channel {
+		uint8_t slots = 0;  // operators keyed on
+		bool playing = false;
+		uint8_t key = 0;
+		uint8_t velocity = 0;
+		int bend = 0;
+		double level = 0;   // carrier attenuation in dB at note on
+		uint8_t expression = 127;
+		int program = -1;
+		int pan = -1;
+	} channels[6];
+
+	auto reg(uint channel, uint base, uint op = 0) -> uint8_t& { return regs[channel / 3][base + channel % 3 + op * 4]; }
+	auto carriers(uint channel) -> uint;
+	auto attenuation(uint channel) -> double;
+	auto pitch(uint channel) -> double;
+	auto patch(uint channel) -> uint;
+
+	auto noteOn(uint32_t time, uint channel) -> void;
+	auto noteOff(uint32_t time, uint channel) -> void;
+	auto retune(uint32_t time, uint channel) -> void;
+	auto relevel(uint32_t time, uint channel) -> void;
+};
+
+// Carrier operators by algorithm, as a mask of operator register slots ($30, $34, $38, $3C = S1, S3, S2, S4):
+auto FMTranscriber::carriers(uint channel) -> uint {
+	static const uint8_t masks[8] = {0x8, 0x8, 0x8, 0x8, 0xc, 0xe, 0xe, 0xf};
+	return masks[reg(channel, 0xb0) & 7];
+}
+
+// Loudest carrier's total level; 0.75dB per step:
+auto FMTranscriber::attenuation(uint channel) -> double {
+	uint level = 0x7f;
+	for (uint op = 0; op < 4; op++) {
+		if (carriers(channel) & 1 << op) level = min(level, reg(channel, 0x40, op) & 0x7f);
+	}
+	return level * 0.75;
+}
+
+// Pitch in MIDI semitones, including the S4 carrier's frequency multiple:
+auto FMTranscriber::pitch(uint channel) -> double {
+	uint fnum = (reg(channel, 0xa4) & 7) << 8 | reg(channel, 0xa0);
+	uint block = reg(channel, 0xa4) >> 3 & 7;
+	if (!fnum) return 0;
+	uint multiple = reg(channel, 0x30, 3) & 15;
+	double hz = fnum * (double)(1 << block) * clock / (144.0 * (1 << 21)) * (multiple ? multiple : 0.5);
+	return 69.0 + 12.0 * log2(hz / 440.0);
+}
+
+auto FMTranscriber::patch(uint channel) -> uint {
+	Patch patch;
+	uint n = 0;
+	patch.data[n++] = reg(channel, 0xb0) & 0x3f;
+	patch.data[n++] = reg(channel, 0xb4) & 0x37;
+	for (uint op = 0; op < 4; op++) {
+		patch.data[n++] = reg(channel, 0x30, op) & 0x7f;
+		patch.data[n++] = carriers(channel) & 1 << op ? 0 : reg(channel, 0x40, op) & 0x7f;
+		patch.data[n++] = reg(channel, 0x50, op) & 0xdf;
+		patch.data[n++] = reg(channel, 0x60, op) & 0x9f;
+		patch.data[n++] = reg(channel, 0x70, op) & 0x1f;
+		patch.data[n++] = reg(channel, 0x80, op);
+		patch.data[n++] = reg(channel, 0x90, op) & 0x0f;
+	}
+
+	if (auto known = patchTable.find(patch)) return known().program;
+	patch.program = patches.size();
+	patchTable.insert(patch);
+	patches.append(patch);
+	return patch.program;
+}
+
+auto FMTranscriber::noteOn(uint32_t time, uint channel) -> void {
+	auto& c = channels[channel];
+	double p = pitch(channel);
+	if (p < 0 || p > 127) return;
+
+	// Programs past 127 continue in the following banks:
+	uint program = patch(channel);
+	if (c.program < 0 || c.program >> 7 != program >> 7) midi.controlChange(time, channel, 0x00, program >> 7);
+	if (c.program != program) midi.programChange(time, channel, program & 0x7f);
+	c.program = program;
+
+	// Within two semitones (the default bend range) of the nearest key:
+	c.key = round(p);
+	int bend = max(-8192, min(8191, (int)round((p - c.key) / 2.0 * 8192.0)));
+	if (c.bend != bend) midi.pitchBend(time, channel, c.bend = bend);
+
+	if (c.expression != 127) midi.controlChange(time, channel, 0x0b, c.expression = 127);
+
+	// Velocity follows the usual 40log10 MIDI volume curve:
+	c.level = attenuation(channel);
+	c.velocity = max(1, min(127, (int)round(127.0 * pow(10.0, -c.level / 40.0))));
+	midi.noteOn(time, channel, c.key, c.velocity);
+	c.playing = true;
+}
+
+auto FMTranscriber::noteOff(uint32_t time, uint channel) -> void {
+	auto& c = channels[channel];
+	if (!c.playing) return;
+	midi.noteOff(time, channel, c.key);
+	c.playing = false;
+}
+
+auto FMTranscriber::retune(uint32_t time, uint channel) -> void {
+	auto& c = channels[channel];
+	if (!c.playing) return;
+	double p = pitch(channel);
+	if (fabs(p - c.key) <= 2.0) {
+		int bend = max(-8192, min(8191, (int)round((p - c.key) / 2.0 * 8192.0)));
+		if (c.bend != bend) midi.pitchBend(time, channel, c.bend = bend);
+		return;
+	}
+
+	// Out of bend range; continue on a new key:
+	noteOff(time, channel);
+	noteOn(time, channel);
+}
+
+auto FMTranscriber::relevel(uint32_t time, uint channel) -> void {
+	auto& c = channels[channel];
+	if (!c.playing) return;
+	double change = attenuation(channel) - c.level;
+	uint8_t expression = max(0, min(127, (int)round(127.0 * pow(10.0, -change / 40.0))));
+	if (c.expression != expression) midi.controlChange(time, channel, 0x0b, c.expression = expression);
+}
+
+auto FMTranscriber::write(uint32_t time, uint9 address, uint8_t data) -> void {
+	uint port = address.bit(8);
+	uint8_t index = address;
+
+	if (address == 0x028) {
+		// Key on/off: 0,1,2,4,5,6 => 0,1,2,3,4,5
+		uint channel = data & 7;
+		if (channel == 3 || channel == 7) return;
+		if (channel >= 4) channel--;
+		if (channel == 5 && dac) return;
+
+		auto& c = channels[channel];
+		// The slot bits are S1, S2, S3, S4; the register slots are S1, S3, S2, S4:
+		uint8_t slots = data >> 4 & 0x9 | data >> 5 & 0x2 | data >> 3 & 0x4;
+		if (!c.slots && slots) noteOn(time, channel);
+		if (c.slots && !slots) noteOff(time, channel);
+		c.slots = slots;
+		return;
+	}
+
+	if (address == 0x02b) {
+		// DAC enable; channel 6 plays samples rather than FM:
+		dac = data & 0x80;
+		if (dac) noteOff(time, 5);
+		return;
+	}
+
+	if (index < 0x30 || (index & 3) == 3) {
+		regs[port][index] = data;
+		return;
+	}
+	uint channel = port * 3 + (index & 3);
+
+	if ((index & 0xfc) == 0xa4) {
+		pitchLatch[port][index & 3] = data;
+		return;
+	}
+	if ((index & 0xfc) == 0xa0) {
+		regs[port][index] = data;
+		regs[port][index + 4] = pitchLatch[port][index & 3];
+		retune(time, channel);
+		return;
+	}
+
+	bool carrierLevel = (index & 0xf0) == 0x40 && carriers(channel) & 1 << (index >> 2 & 3);
+	regs[port][index] = data;
+	if (carrierLevel) relevel(time, channel);
+
+	if ((index & 0xfc) == 0xb4) {
+		// Panning: right only, left only, or center:
+		int pan = (data & 0xc0) == 0x40 ? 127 : (data & 0xc0) == 0x80 ? 0 : 64;
+		auto& c = channels[channel];
+		if (c.pan != pan) midi.controlChange(time, channel, 0x0a, c.pan = pan);
+	}
+}
+
+auto FMTranscriber::finish(uint32_t time) -> void {
+	for (uint channel = 0; channel < 6; channel++) noteOff(time, channel);
+}
+
+auto FMTranscriber::exportPatches(string filename) -> void {
+	// Patch table as BML; register values as written, with carrier total levels omitted:
+	string table;
+	for (auto& patch : patches) {
+		auto data = patch.data;
+		table.append("patch program=", patch.program & 0x7f, " bank=", patch.program >> 7, "\n");
+		table.append("  algorithm: ", data[0] & 7, "\n");
+		table.append("  feedback: ", data[0] >> 3 & 7, "\n");
+		table.append("  ams: ", data[1] >> 4 & 3, "\n");
+		table.append("  fms: ", data[1] & 7, "\n");
+		for (uint op = 0; op < 4; op++) {
+			auto o = data + 2 + op * 7;
+			// Register slots S1, S3, S2, S4 => operators 1, 3, 2, 4:
+			static const uint slots[4] = {1, 3, 2, 4};
+			table.append("  operator slot=", slots[op], "\n");
+			table.append("    detune: ", o[0] >> 4 & 7, "\n");
+			table.append("    multiple: ", o[0] & 15, "\n");
+			table.append("    total-level: ", o[1], "\n");
+			table.append("    key-scale: ", o[2] >> 6, "\n");
+			table.append("    attack-rate: ", o[2] & 31, "\n");
+			table.append("    amplitude-modulation: ", o[3] >> 7, "\n");
+			table.append("    decay-rate: ", o[3] & 31, "\n");
+			table.append("    sustain-rate: ", o[4] & 31, "\n");
+			table.append("    sustain-level: ", o[5] >> 4, "\n");
+			table.append("    release-rate: ", o[5] & 15, "\n");
+			table.append("    ssg-eg: ", o[6], "\n");
+		}
+		table.append("\n");
+	}
+
+	if (!file::write(filename, table)) {
+		print("Failed to write ", filename, "\n");
+		return;
+	}
+	print("Exported ", patches.size(), " patches to ", filename, "\n");
+}
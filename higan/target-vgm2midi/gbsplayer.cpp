@@ -0,0 +1,216 @@
+#include <gb/gb.hpp>
+
+struct GBSPlayer : Emulator::Platform {
+	~GBSPlayer();
+	auto run(string filename, Arguments arguments) -> void;
+
+	// Hard-coded manifest.bml for Game Boy; there is no boot ROM:
+	string gb_sys_manifest = "system name:Game Boy";
+
+	// Generated manifest and supporting data for GBS file:
+	string manifest;
+	vector<uint8_t> prgrom;
+
+	// Length and fade of the render:
+	PlayTime playTime;
+
+	// WAVE file writing out:
+	file_buffer wave;
+	long samples;
+
+	GameBoy::Interface* gb = nullptr;
+
+	GameBoy::CPU* cpu;
+	GameBoy::APU* apu;
+	GameBoy::Scheduler* scheduler;
+
+	// Emulator::Platform
+	auto path(uint id) -> string override;
+	auto open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file override;
+	auto load(uint id, string name, string type, vector<string> options = {}) -> Emulator::Platform::Load override;
+	auto videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void override;
+	auto audioSample(const double* samples, uint channels) -> void override;
+	auto inputPoll(uint port, uint device, uint input) -> int16 override;
+	auto inputRumble(uint port, uint device, uint input, bool enable) -> void override;
+	auto dipSettings(Markup::Node node) -> uint override;
+	auto notify(string text) -> void override;
+};
+
+GBSPlayer::~GBSPlayer() {
+	if (gb) gb->unload();
+	delete gb;
+}
+
+auto GBSPlayer::path(uint id) -> string {
+	return "";
+}
+auto GBSPlayer::open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file {
+	if (id == GameBoy::ID::System) {
+		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(gb_sys_manifest.data<uint8_t>(), gb_sys_manifest.size());
+		}
+	} else {
+		// Game Boy or Game Boy Color:
+		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
+			// Load the manifest generated from the GBS file:
+			return vfs::memory::file::view(manifest.data<uint8_t>(), manifest.size());
+		} else if (name == "program.rom" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(prgrom.data<uint8_t>(), prgrom.size());
+		}
+	}
+
+	if (required) {
+		print("platform::open  Missing required file {0}\n", string_format{name});
+	}
+
+	return {};
+}
+auto GBSPlayer::load(uint id, string name, string type, vector<string> options) -> Emulator::Platform::Load {
+	return {id};
+}
+auto GBSPlayer::videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void {
+}
+auto GBSPlayer::audioSample(const double* samples, uint channels) -> void {
+	// Game Boy APU is stereo:
+	assert(channels == 2);
+
+	// The last frame runs past the end:
+	double time = this->samples / 48000.0;
+	if (time >= playTime.total()) return;
+
+	// Write 16-bit samples:
+	auto x = (int16_t)(samples[0] * playTime.gain(time) * 32767.0);
+	auto y = (int16_t)(samples[1] * playTime.gain(time) * 32767.0);
+	wave.write({&x, sizeof(int16_t)});
+	wave.write({&y, sizeof(int16_t)});
+	this->samples++;
+}
+auto GBSPlayer::inputPoll(uint port, uint device, uint input) -> int16 {
+	return 0;
+}
+auto GBSPlayer::inputRumble(uint port, uint device, uint input, bool enable) -> void {}
+auto GBSPlayer::dipSettings(Markup::Node node) -> uint {
+	return 0;
+}
+auto GBSPlayer::notify(string text) -> void {
+	print("notify(\"{0}\")\n", string_format{text});
+}
+
+auto GBSPlayer::run(string filename, Arguments arguments) -> void {
+	playTime.take(arguments);
+
+	auto input = archive.open(filename);
+	if (!input) return;
+	auto& buf = *input;
+	if (buf.size() < 0x70 || buf.reads(3) != "GBS") {
+		print("Missing GBS header for GBS!\n");
+		return;
+	}
+	if (buf.readl(1) != 0x01) {
+		print("Bad GBS version!\n");
+		return;
+	}
+	auto song_count = buf.readl(1);
+	auto first_song = buf.readl(1);
+	uint16_t addr_load = buf.readl(2);
+	uint16_t addr_init = buf.readl(2);
+	uint16_t addr_play = buf.readl(2);
+	uint16_t stack_pointer = buf.readl(2);
+	uint8_t timer_modulo = buf.readl(1);
+	uint8_t timer_control = buf.readl(1);
+	auto song_name = buf.reads(32);
+	auto artist_name = buf.reads(32);
+	auto copyright_name = buf.reads(32);
+
+	// We've read the entire header now:
+	assert(buf.offset() == 0x70);
+
+	// The player occupies the first page of bank 0:
+	if (addr_load < 0x0100 || addr_load >= 0x8000) {
+		print("Bad GBS load address ", hex(addr_load, 4), "!\n");
+		return;
+	}
+
+	// Track number (0-based); defaults to the header's first song:
+	auto track_s = arguments.take();
+	auto track = track_s ? track_s.natural() : (first_song ? first_song - 1 : 0);
+
+	// Build a ROM image with the song data at its load address, in whole 16KB banks:
+	auto size = (uint)(buf.size() - buf.offset());
+	prgrom.resize((addr_load + size + 0x3fff) & ~0x3fff);
+	prgrom.fill(0xFF);
+	buf.read({prgrom.data<uint8_t>() + addr_load, size});
+	input.reset();
+
+	// Build a temporary manifest for cartridge to load:
+	manifest = "";
+	manifest.append("game\n");
+	manifest.append("  label:  ", song_name, "\n");
+	manifest.append("  name:   ", filename, "\n");
+
+	manifest.append("  board:  GBS\n");
+	manifest.append("    gbs\n");
+	manifest.append("      load: 0x", hex(addr_load, 4), "\n");
+	manifest.append("      init: 0x", hex(addr_init, 4), "\n");
+	manifest.append("      play: 0x", hex(addr_play, 4), "\n");
+	manifest.append("      stack: 0x", hex(stack_pointer, 4), "\n");
+	manifest.append("      timer modulo=0x", hex(timer_modulo, 2), " control=0x", hex(timer_control, 2), "\n");
+	manifest.append("      song: ", track, "\n");
+
+	manifest.append("    memory\n");
+	manifest.append("      type: ", "ROM", "\n");
+	manifest.append("      size: 0x", hex(prgrom.size()), "\n");
+	manifest.append("      content: ", "Program", "\n");
+	manifest.append("    memory\n");
+	manifest.append("      type: ", "RAM", "\n");
+	manifest.append("      size: 0x2000\n");
+	manifest.append("      content: ", "Save", "\n");
+	manifest.append("      volatile\n");
+
+	print("Song:      ", song_name, "\n");
+	print("Artist:    ", artist_name, "\n");
+	print("Copyright: ", copyright_name, "\n");
+	print("song count: {0}, start: {1}\n", string_format{song_count, first_song});
+
+	Emulator::audio.setFrequency(48000);
+	Emulator::audio.setVolume(1.0);
+	Emulator::audio.setBalance(0.0);
+
+	// Rips that ask for double speed need a Game Boy Color:
+	if (timer_control & 0x80) {
+		gb = new GameBoy::GameBoyColorInterface;
+	} else {
+		gb = new GameBoy::GameBoyInterface;
+	}
+	if (!gb->load()) {
+		print("Game Boy failed load()\n");
+		return;
+	}
+	// No video; the GBS mapper's frame timer replaces the PPU thread:
+	GameBoy::ppu.disabled = true;
+
+	gb->power();
+
+	cpu = &GameBoy::cpu;
+	apu = &GameBoy::apu;
+	scheduler = &GameBoy::scheduler;
+
+	wave = openWave(outputFilename);
+	samples = 0;
+
+	const long total_samples = (long)(playTime.total() * 48000);
+
+	int seconds = 0;
+	print("time: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+	do
+	{
+		scheduler->enter();
+		if (samples / 48000 > seconds) {
+			seconds = samples / 48000;
+			print("\b\b\b\b\b\b\b\b\b\b\b\rtime: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+		}
+	} while (samples < total_samples);
+	print("\n");
+
+	closeWave(wave, 2, 16, 48000, samples);
+}
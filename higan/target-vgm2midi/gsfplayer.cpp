@@ -0,0 +1,369 @@
+#include <gba/gba.hpp>
+
+struct GSFPlayer : Emulator::Platform {
+	~GSFPlayer();
+	auto run(string filename, Arguments arguments) -> void;
+
+	// Hard-coded manifest.bml for Game Boy Advance; the BIOS is supplied with --bios:
+	string gba_sys_manifest =
+		"system\n"
+		"  cpu\n"
+		"    rom\n"
+		"      name: bios.rom\n"
+		"      size: 16384\n";
+	vector<uint8_t> bios;
+
+	// PSF container; GSF programs with their _lib chain loaded beneath them:
+	auto loadPSF(string filename, uint depth) -> bool;
+	auto loadProgram(const uint8_t* data, uint size) -> bool;
+	maybe<uint32_t> entry;   // Taken from the first program loaded, which is the innermost _lib.
+	vector<uint8_t> ewram;   // Multiboot programs, loaded at $02000000.
+	vector<uint8_t> prgrom;  // Cartridge programs, loaded at $08000000.
+	vector<string> tags;     // "key=value" pairs of the file played.
+
+	// Generated manifest for the GSF program:
+	string manifest;
+
+	// Direct Sound capture; the samples of each FIFO in use as its timer takes them, to fifo_a.wav and fifo_b.wav:
+	file_buffer fifoWave[2];
+	long fifoSamples[2];
+	uint fifoRate[2];
+
+	// WAVE file writing out:
+	file_buffer wave;
+	long samples;
+
+	GameBoyAdvance::Interface* gba = nullptr;
+
+	GameBoyAdvance::CPU* cpu;
+	GameBoyAdvance::APU* apu;
+	GameBoyAdvance::Scheduler* scheduler;
+
+	// Emulator::Platform
+	auto path(uint id) -> string override;
+	auto open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file override;
+	auto load(uint id, string name, string type, vector<string> options = {}) -> Emulator::Platform::Load override;
+	auto videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void override;
+	auto audioSample(const double* samples, uint channels) -> void override;
+	auto inputPoll(uint port, uint device, uint input) -> int16 override;
+	auto inputRumble(uint port, uint device, uint input, bool enable) -> void override;
+	auto dipSettings(Markup::Node node) -> uint override;
+	auto notify(string text) -> void override;
+};
+
+GSFPlayer::~GSFPlayer() {
+	if (gba) gba->unload();
+	delete gba;
+}
+
+auto GSFPlayer::path(uint id) -> string {
+	return "";
+}
+auto GSFPlayer::open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file {
+	if (id == GameBoyAdvance::ID::System) {
+		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(gba_sys_manifest.data<uint8_t>(), gba_sys_manifest.size());
+		} else if (name == "bios.rom" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(bios.data<uint8_t>(), bios.size());
+		}
+	}
+
+	if (id == GameBoyAdvance::ID::GameBoyAdvance) {
+		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
+			// Load the manifest generated from the GSF file:
+			return vfs::memory::file::view(manifest.data<uint8_t>(), manifest.size());
+		} else if (name == "program.rom" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(prgrom.data<uint8_t>(), prgrom.size());
+		}
+	}
+
+	if (required) {
+		print("platform::open  Missing required file {0}\n", string_format{name});
+	}
+
+	return {};
+}
+auto GSFPlayer::load(uint id, string name, string type, vector<string> options) -> Emulator::Platform::Load {
+	return {id};
+}
+auto GSFPlayer::videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void {
+}
+auto GSFPlayer::audioSample(const double* samples, uint channels) -> void {
+	// Game Boy Advance APU is stereo:
+	assert(channels == 2);
+
+	// Write 16-bit samples:
+	auto x = (int16_t)(samples[0] * 32767.0);
+	auto y = (int16_t)(samples[1] * 32767.0);
+	wave.write({&x, sizeof(int16_t)});
+	wave.write({&y, sizeof(int16_t)});
+	this->samples++;
+}
+auto GSFPlayer::inputPoll(uint port, uint device, uint input) -> int16 {
+	return 0;
+}
+auto GSFPlayer::inputRumble(uint port, uint device, uint input, bool enable) -> void {}
+auto GSFPlayer::dipSettings(Markup::Node node) -> uint {
+	return 0;
+}
+auto GSFPlayer::notify(string text) -> void {
+	print("notify(\"{0}\")\n", string_format{text});
+}
+
+auto GSFPlayer::loadPSF(string filename, uint depth) -> bool {
+	// Libraries may chain, but not forever:
+	if (depth > 10) {
+		print("Too many nested _lib files at ", filename, "\n");
+		return false;
+	}
+
+	auto psf = archive.read(filename);
+	if (psf.size() < 16 || memory::compare(psf.data(), "PSF", 3)) {
+		print("Missing PSF header for ", filename, "!\n");
+		return false;
+	}
+	if (psf[3] != 0x22) {
+		print("Not a GSF; PSF version ", hex(psf[3], 2), " in ", filename, "!\n");
+		return false;
+	}
+
+	auto read32 = [&](uint offset) -> uint32_t {
+		return psf[offset + 0] << 0 | psf[offset + 1] << 8 | psf[offset + 2] << 16 | psf[offset + 3] << 24;
+	};
+	uint32_t reserved_size = read32(4);
+	uint32_t program_size = read32(8);
+	uint32_t program_crc = read32(12);
+	uint64_t program_offset = 16 + (uint64_t)reserved_size;
+	if (program_offset + program_size > psf.size()) {
+		print("Truncated PSF ", filename, "!\n");
+		return false;
+	}
+
+	// Tags follow the program; key=value, one per line:
+	vector<string> fileTags;
+	uint64_t tag_offset = program_offset + program_size;
+	if (psf.size() - tag_offset >= 5 && !memory::compare(psf.data() + tag_offset, "[TAG]", 5)) {
+		string text;
+		text.resize(psf.size() - tag_offset - 5);
+		memory::copy(text.get(), psf.data() + tag_offset + 5, text.size());
+		for (auto line : text.split("\n")) {
+			auto part = line.split("=", 1L);
+			if (part.size() != 2) continue;
+			part[0].strip().downcase();
+			part[1].strip();
+			fileTags.append(string{part[0], "=", part[1]});
+		}
+	}
+	auto tag = [&](string key) -> string {
+		for (auto& pair : fileTags) {
+			if (pair.beginsWith(string{key, "="})) return slice(pair, key.size() + 1);
+		}
+		return "";
+	};
+	if (depth == 0) tags = fileTags;
+
+	// The main library lies beneath this file's program:
+	if (auto lib = tag("_lib")) {
+		if (!loadPSF(archive.sibling(filename, lib), depth + 1)) return false;
+	}
+
+	if (program_size) {
+		auto compressed = psf.data() + program_offset;
+		if (Hash::CRC32({compressed, program_size}).value() != program_crc) {
+			print("CRC mismatch in ", filename, "\n");
+		}
+
+		// zlib stream; a two-byte header then deflate. The program holds a 12-byte header and at most 32MB:
+		if (program_size < 2 || (compressed[0] & 0x0f) != 8) {
+			print("Unknown compression in ", filename, "!\n");
+			return false;
+		}
+		vector<uint8_t> program;
+		program.resize(12 + 32 * 1024 * 1024);
+		unsigned long target_size = program.size();
+		unsigned long source_size = program_size - 2;
+		if (Decode::puff::puff(program.data(), &target_size, (unsigned char*)compressed + 2, &source_size) != 0) {
+			print("Failed to decompress ", filename, "!\n");
+			return false;
+		}
+		if (!loadProgram(program.data(), target_size)) {
+			print("Bad GSF program in ", filename, "!\n");
+			return false;
+		}
+	}
+
+	// Supplementary libraries are loaded over it, in order:
+	for (uint n = 2;; n++) {
+		auto lib = tag({"_lib", n});
+		if (!lib) break;
+		if (!loadPSF(archive.sibling(filename, lib), depth + 1)) return false;
+	}
+
+	return true;
+}
+
+auto GSFPlayer::loadProgram(const uint8_t* data, uint size) -> bool {
+	if (size < 12) return false;
+	auto read32 = [&](uint offset) -> uint32_t {
+		return data[offset + 0] << 0 | data[offset + 1] << 8 | data[offset + 2] << 16 | data[offset + 3] << 24;
+	};
+	uint32_t entry_point = read32(0);
+	uint32_t offset = read32(4);
+	uint32_t length = min(read32(8), size - 12);
+	if (!entry) entry = entry_point;
+
+	if ((offset >> 24) == 0x02) {
+		// Multiboot; mirrored through the 256KB of EWRAM:
+		for (uint n : range(length)) ewram[(offset + n) & 0x3ffff] = data[12 + n];
+	} else {
+		// Cartridge ROM, up to 32MB:
+		offset &= 0x01ffffff;
+		length = min(length, 0x02000000 - offset);
+		if (prgrom.size() < offset + length) prgrom.resize(offset + length);
+		memory::copy(prgrom.data() + offset, data + 12, length);
+	}
+	return true;
+}
+
+auto GSFPlayer::run(string filename, Arguments arguments) -> void {
+	// The GBA BIOS is needed for the interrupt dispatcher and the SWI calls sound drivers make:
+	string biosFilename;
+	arguments.take("--bios", biosFilename);
+	// Optional capture of each Direct Sound FIFO at its own sample rate:
+	bool captureFIFO = false;
+	arguments.take("--fifo", captureFIFO);
+
+	if (!biosFilename) {
+		print("GSF playback needs a GBA BIOS; pass it with --bios <file>\n");
+		return;
+	}
+	bios = archive.read(biosFilename);
+	if (bios.size() != 16384) {
+		print("Bad GBA BIOS ", biosFilename, "; expected 16384 bytes\n");
+		return;
+	}
+
+	ewram.resize(256 * 1024);
+	prgrom.reset();
+	entry = nothing;
+	if (!loadPSF(filename, 0)) return;
+	if (!entry) {
+		print("Missing GSF program!\n");
+		return;
+	}
+
+	// Multiboot programs still need a cartridge to load:
+	if (!prgrom) prgrom.resize(4);
+
+	auto tag = [&](string key) -> string {
+		for (auto& pair : tags) {
+			if (pair.beginsWith(string{key, "="})) return slice(pair, key.size() + 1);
+		}
+		return "";
+	};
+
+	// Build a temporary manifest for cartridge to load:
+	manifest = "";
+	manifest.append("game\n");
+	manifest.append("  label:  ", tag("title") ? tag("title") : Location::prefix(filename), "\n");
+	manifest.append("  name:   ", filename, "\n");
+	manifest.append("  board\n");
+	manifest.append("    memory\n");
+	manifest.append("      type: ", "ROM", "\n");
+	manifest.append("      size: 0x", hex(prgrom.size()), "\n");
+	manifest.append("      content: ", "Program", "\n");
+
+	print("Title:  ", tag("title"), "\n");
+	print("Artist: ", tag("artist"), "\n");
+	print("Game:   ", tag("game"), "\n");
+	print("Length: ", tag("length"), "\n");
+	print("entry: 0x{0}, rom: 0x{1}\n", string_format{hex(entry(), 8), hex(prgrom.size())});
+
+	Emulator::audio.setFrequency(48000);
+	Emulator::audio.setVolume(1.0);
+	Emulator::audio.setBalance(0.0);
+
+	gba = new GameBoyAdvance::Interface;
+	if (!gba->load()) {
+		print("Game Boy Advance failed load()\n");
+		return;
+	}
+	// No video; the PPU keeps its scanline timing for the vblank interrupt and DMA:
+	GameBoyAdvance::ppu.disabled = true;
+
+	gba->power();
+
+	cpu = &GameBoyAdvance::cpu;
+	apu = &GameBoyAdvance::apu;
+	scheduler = &GameBoyAdvance::scheduler;
+
+	// Skip the BIOS boot, leaving the registers as it would and entering the program in system mode:
+	using PSR = Processor::ARM7TDMI::PSR;
+	memory::copy(cpu->ewram, ewram.data(), ewram.size());
+	cpu->processor.svc.r13 = 0x03007fe0;
+	cpu->processor.irq.r13 = 0x03007fa0;
+	cpu->processor.r13 = 0x03007f00;
+	cpu->processor.cpsr = (uint32)PSR::SYS;
+	cpu->processor.r15 = entry();
+
+	if (captureFIFO) {
+		for (uint n : range(2)) {
+			fifoSamples[n] = 0;
+			fifoRate[n] = 0;
+
+			apu->fifo[n].capture = [&, n](int8 sample) {
+				// Only FIFOs sent to an output are captured:
+				auto& fifo = apu->fifo[n];
+				if (!fifo.lenable && !fifo.renable) return;
+
+				if (!fifoSamples[n]) {
+					// The rate is that of the timer when the first sample is taken:
+					static const uint prescale[] = {0, 6, 8, 10};
+					auto& timer = cpu->timer[fifo.timer];
+					fifoRate[n] = (uint)(GameBoyAdvance::system.frequency() / ((65536 - timer.reload) << prescale[timer.frequency]));
+
+					fifoWave[n] = openWave(outputName(n == 0 ? "fifo_a.wav" : "fifo_b.wav"));
+				}
+				uint8_t data = (uint8_t)(sample + 128);
+				fifoWave[n].write(data);
+				fifoSamples[n]++;
+			};
+		}
+	}
+
+	wave = openWave(outputFilename);
+	samples = 0;
+
+	const long play_seconds = 4 * 60;
+
+	// Frames are 228 scanlines of 1232 clocks:
+	const long frame_clocks = 228 * 1232;
+	const long second_clocks = 16 * 1024 * 1024;
+
+	long elapsed = 0;  // Clocks into the current second.
+	int seconds = 0;
+	print("time: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+	do
+	{
+		if (scheduler->enter() == Emulator::Scheduler::Event::Frame) {
+			elapsed += frame_clocks;
+			if (elapsed >= second_clocks) {
+				seconds++;
+				elapsed -= second_clocks;
+				print("\b\b\b\b\b\b\b\b\b\b\b\rtime: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+			}
+		}
+	} while (seconds < play_seconds);
+	print("\n");
+
+	if (captureFIFO) {
+		for (uint n : range(2)) {
+			apu->fifo[n].capture.reset();
+			if (!fifoSamples[n]) continue;
+			print("FIFO ", n == 0 ? "A" : "B", ": ", fifoSamples[n], " samples at ", fifoRate[n], "Hz\n");
+			closeWave(fifoWave[n], 1, 8, fifoRate[n], fifoSamples[n]);
+		}
+	}
+
+	closeWave(wave, 2, 16, 48000, samples);
+}
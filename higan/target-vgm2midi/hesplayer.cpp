@@ -0,0 +1,279 @@
+#include <pce/pce.hpp>
+
+struct HESPlayer : Emulator::Platform {
+	~HESPlayer();
+	auto run(string filename, Arguments arguments) -> void;
+
+	// Hard-coded manifest.bml for PC Engine:
+	string pce_sys_manifest = "system name:PC Engine";
+
+	// Generated manifest and supporting data for HES file:
+	string manifest;
+	vector<uint8_t> prgrom;
+
+	// Instrument export; one 32-sample wavetable per distinct waveform heard, in order of first use:
+	struct Waveform {
+		uint8_t data[32];
+	};
+	vector<Waveform> waveforms;
+	auto trackWaveforms() -> void;
+	auto exportWaveforms(string filename) -> void;
+
+	// WAVE file writing out:
+	file_buffer wave;
+	long samples;
+
+	PCEngine::Interface* pce = nullptr;
+
+	PCEngine::CPU* cpu;
+	PCEngine::PSG* psg;
+	PCEngine::Scheduler* scheduler;
+
+	// Emulator::Platform
+	auto path(uint id) -> string override;
+	auto open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file override;
+	auto load(uint id, string name, string type, vector<string> options = {}) -> Emulator::Platform::Load override;
+	auto videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void override;
+	auto audioSample(const double* samples, uint channels) -> void override;
+	auto inputPoll(uint port, uint device, uint input) -> int16 override;
+	auto inputRumble(uint port, uint device, uint input, bool enable) -> void override;
+	auto dipSettings(Markup::Node node) -> uint override;
+	auto notify(string text) -> void override;
+};
+
+HESPlayer::~HESPlayer() {
+	if (pce) pce->unload();
+	delete pce;
+}
+
+auto HESPlayer::path(uint id) -> string {
+	return "";
+}
+auto HESPlayer::open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file {
+	if (id == PCEngine::ID::System) {
+		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(pce_sys_manifest.data<uint8_t>(), pce_sys_manifest.size());
+		}
+	}
+
+	if (id == PCEngine::ID::PCEngine) {
+		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
+			// Load the manifest generated from the HES file:
+			return vfs::memory::file::view(manifest.data<uint8_t>(), manifest.size());
+		} else if (name == "program.rom" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(prgrom.data<uint8_t>(), prgrom.size());
+		}
+	}
+
+	if (required) {
+		print("platform::open  Missing required file {0}\n", string_format{name});
+	}
+
+	return {};
+}
+auto HESPlayer::load(uint id, string name, string type, vector<string> options) -> Emulator::Platform::Load {
+	return {id};
+}
+auto HESPlayer::videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void {
+}
+auto HESPlayer::audioSample(const double* samples, uint channels) -> void {
+	// PC Engine PSG is stereo:
+	assert(channels == 2);
+
+	// Write 16-bit samples:
+	auto x = (int16_t)(samples[0] * 32767.0);
+	auto y = (int16_t)(samples[1] * 32767.0);
+	wave.write({&x, sizeof(int16_t)});
+	wave.write({&y, sizeof(int16_t)});
+	this->samples++;
+}
+auto HESPlayer::inputPoll(uint port, uint device, uint input) -> int16 {
+	return 0;
+}
+auto HESPlayer::inputRumble(uint port, uint device, uint input, bool enable) -> void {}
+auto HESPlayer::dipSettings(Markup::Node node) -> uint {
+	return 0;
+}
+auto HESPlayer::notify(string text) -> void {
+	print("notify(\"{0}\")\n", string_format{text});
+}
+
+auto HESPlayer::trackWaveforms() -> void {
+	// Record each wavetable a channel plays from, the first time it is heard:
+	for (uint channel = 0; channel < 6; channel++) {
+		Waveform waveform;
+		if (!psg->waveform(channel, waveform.data)) continue;
+
+		bool known = false;
+		for (auto& w : waveforms) {
+			if (!memory::compare(w.data, waveform.data, sizeof(waveform.data))) {
+				known = true;
+				break;
+			}
+		}
+		if (!known) waveforms.append(waveform);
+	}
+}
+
+auto HESPlayer::exportWaveforms(string filename) -> void {
+	SoundFont soundfont;
+	for (uint n = 0; n < waveforms.size(); n++) {
+		SoundFont::Instrument instrument;
+
+		// Programs are wavetables in order of first use; past 127 they continue in the following banks:
+		instrument.name = {"Wave ", pad(n, 3, '0')};
+		instrument.bank = n >> 7;
+		instrument.program = n & 0x7f;
+
+		// One period of unsigned 5-bit samples, looped:
+		for (auto sample : waveforms[n].data) instrument.pcm.append((int(sample) - 16) << 11);
+		instrument.looped = true;
+		instrument.loopStart = 0;
+
+		// A channel steps through one sample per period of its frequency divider,
+		// so the 32 samples are one cycle; at this rate, the root key sounds at its own pitch:
+		instrument.rootKey = 60;
+		instrument.sampleRate = (uint32_t)round(32.0 * 440.0 * pow(2.0, (60 - 69) / 12.0));
+		soundfont.instruments.append(instrument);
+	}
+
+	if (!soundfont.save(filename)) {
+		print("Failed to write ", filename, "\n");
+		return;
+	}
+	print("Exported ", soundfont.instruments.size(), " wavetables to ", filename, "\n");
+}
+
+auto HESPlayer::run(string filename, Arguments arguments) -> void {
+	// Optional SoundFont 2 export of the wavetables heard:
+	string soundfontFilename;
+	if (arguments.take("--sf2", soundfontFilename)) soundfontFilename = outputName(soundfontFilename);
+
+	auto input = archive.open(filename);
+	if (!input) return;
+	auto& buf = *input;
+	if (buf.size() < 0x20 || buf.reads(4) != "HESM") {
+		print("Missing HESM header for HES!\n");
+		return;
+	}
+	auto version = buf.readl(1);
+	auto start_song = buf.readl(1);
+	uint16_t addr_init = buf.readl(2);
+	uint8_t mpr[8];
+	for (auto& bank : mpr) bank = buf.readl(1);
+	if (version != 0x00) {
+		print("Unknown HES version ", version, "\n");
+	}
+
+	// Track number (0-based); defaults to the header's starting song:
+	auto track_s = arguments.take();
+	auto track = track_s ? track_s.natural() : start_song;
+
+	// Data blocks, each loaded at a physical address in the 1MB HuCard space:
+	struct Block {
+		uint32_t address;
+		vector<uint8_t> data;
+	};
+	vector<Block> blocks;
+	uint32_t end = 0;
+	while (buf.size() - buf.offset() >= 16 && buf.reads(4) == "DATA") {
+		Block block;
+		auto size = buf.readl(4);
+		block.address = buf.readl(4) & 0xfffff;
+		buf.readl(4);  // reserved
+		size = min(size, buf.size() - buf.offset());
+		size = min(size, 0x100000 - block.address);
+		block.data.resize(size);
+		buf.read(block.data);
+		end = max(end, block.address + size);
+		blocks.append(block);
+	}
+	input.reset();
+	if (!blocks) {
+		print("Missing DATA block for HES!\n");
+		return;
+	}
+
+	// Build a PRGROM image; a power of two in size, so that the HuCard mirroring is plain:
+	uint32_t size = 0x2000;
+	while (size < end) size <<= 1;
+	prgrom.resize(size);
+	prgrom.fill(0xFF);
+	for (auto& block : blocks) {
+		memory::copy(prgrom.data<uint8_t>() + block.address, block.data.data(), block.data.size());
+	}
+
+	// Build a temporary manifest for cartridge to load:
+	manifest = "";
+	manifest.append("game\n");
+	manifest.append("  label:  ", Location::prefix(filename), "\n");
+	manifest.append("  name:   ", filename, "\n");
+	manifest.append("  board\n");
+	manifest.append("    memory\n");
+	manifest.append("      type: ", "ROM", "\n");
+	manifest.append("      size: 0x", hex(prgrom.size()), "\n");
+	manifest.append("      content: ", "Program", "\n");
+
+	print("init: 0x{0}, mpr: ", string_format{hex(addr_init, 4)});
+	for (auto bank : mpr) print(hex(bank, 2), " ");
+	print("\n");
+	print("data blocks: {0}, start song: {1}\n", string_format{blocks.size(), start_song});
+
+	Emulator::audio.setFrequency(48000);
+	Emulator::audio.setVolume(1.0);
+	Emulator::audio.setBalance(0.0);
+
+	cpu = &PCEngine::cpu;
+	psg = &PCEngine::psg;
+	scheduler = &PCEngine::scheduler;
+
+	// Load and power up only the HuC6280 and PSG; the CPU raises the vblank IRQ itself:
+	pce = new PCEngine::PCEngineInterface;
+	pce->set("Sound Only", true);
+
+	if (!pce->load()) {
+		print("PC Engine failed load()\n");
+		return;
+	}
+	pce->power();
+
+	// Call the init routine with the song number and the header's bank map. It returns to the
+	// idle loop at $1ffd in the hardware page, which enables interrupts and waits for them;
+	// the play routine then runs from the timer or vblank IRQ the song has set up:
+	for (auto n : range(8)) cpu->r.mpr[n] = mpr[n];
+	cpu->r.a = track;
+	cpu->r.p.i = 1;
+	cpu->write(0xf8, 0x01ff, 0x1f);  // Return address ($1ffc; RTS adds one):
+	cpu->write(0xf8, 0x01fe, 0xfc);
+	cpu->r.s = 0xfd;
+	cpu->r.pc = addr_init;
+
+	wave = openWave(outputFilename);
+	samples = 0;
+
+	const long play_seconds = 4 * 60;
+
+	// Frames are 262 lines of 1365 clocks at six times the colorburst frequency:
+	const double frame_seconds = 262.0 * 1365.0 / (Emulator::Constants::Colorburst::NTSC * 6.0);
+
+	double elapsed = 0;  // Seconds into the current second.
+	int seconds = 0;
+	print("time: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+	do
+	{
+		if (scheduler->enter() == Emulator::Scheduler::Event::Frame) {
+			if (soundfontFilename) trackWaveforms();
+			elapsed += frame_seconds;
+			if (elapsed >= 1.0) {
+				seconds++;
+				elapsed -= 1.0;
+				print("\b\b\b\b\b\b\b\b\b\b\b\rtime: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+			}
+		}
+	} while (seconds < play_seconds);
+	print("\n");
+
+	if (soundfontFilename) exportWaveforms(soundfontFilename);
+
+	closeWave(wave, 2, 16, 48000, samples);
+}
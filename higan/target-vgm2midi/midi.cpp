@@ -0,0 +1,87 @@
+// Standard MIDI File writer:
+// Events are appended in time order to a single format 0 track.
+struct MIDI {
+	// With the default division and tempo, one tick is one VGM sample (1/44100th of a second):
+	uint16_t division = 22050;  // ticks per quarter note
+	uint32_t tempo = 500000;    // microseconds per quarter note
+
+	auto noteOn(uint32_t time, uint8_t channel, uint8_t key, uint8_t velocity) -> void {
+		event(time, 0x90 | channel, key, velocity);
+	}
+	auto noteOff(uint32_t time, uint8_t channel, uint8_t key) -> void {
+		event(time, 0x80 | channel, key, 0);
+	}
+	auto controlChange(uint32_t time, uint8_t channel, uint8_t control, uint8_t value) -> void {
+		event(time, 0xb0 | channel, control, value);
+	}
+	auto programChange(uint32_t time, uint8_t channel, uint8_t program) -> void {
+		event(time, 0xc0 | channel, program);
+	}
+	// Bend is centered on zero, from -8192 to +8191:
+	auto pitchBend(uint32_t time, uint8_t channel, int bend) -> void {
+		uint value = bend + 8192;
+		event(time, 0xe0 | channel, value & 0x7f, value >> 7 & 0x7f);
+	}
+
+	auto save(string filename, uint32_t time) -> bool;
+
+private:
+	vector<uint8_t> track;
+	uint32_t last = 0;
+
+	// Big-endian chunk building helpers:
+	static auto put8(vector<uint8_t>& out, uint8_t data) -> void { out.append(data); }
+	static auto put16(vector<uint8_t>& out, uint16_t data) -> void { put8(out, data >> 8); put8(out, data); }
+	static auto put32(vector<uint8_t>& out, uint32_t data) -> void { put16(out, data >> 16); put16(out, data); }
+	static auto putVariable(vector<uint8_t>& out, uint32_t data) -> void {
+		// Seven bits per byte, most significant first; the high bit marks continuation:
+		uint shift = 28;
+		while (shift && !(data >> shift & 0x7f)) shift -= 7;
+		for (; shift; shift -= 7) put8(out, 0x80 | (data >> shift & 0x7f));
+		put8(out, data & 0x7f);
+	}
+
+	auto delta(uint32_t time) -> void {
+		putVariable(track, time - last);
+		last = time;
+	}
+	auto event(uint32_t time, uint8_t status, uint8_t data) -> void {
+		delta(time);
+		put8(track, status);
+		put8(track, data);
+	}
+	auto event(uint32_t time, uint8_t status, uint8_t data1, uint8_t data2) -> void {
+		delta(time);
+		put8(track, status);
+		put8(track, data1);
+		put8(track, data2);
+	}
+};
+
+auto MIDI::save(string filename, uint32_t time) -> bool {
+	// Tempo first, then the recorded events, then the end of track at the given time:
+	vector<uint8_t> data;
+	put8(data, 0x00);
+	put8(data, 0xff);
+	put8(data, 0x51);
+	put8(data, 0x03);
+	put8(data, tempo >> 16);
+	put8(data, tempo >> 8);
+	put8(data, tempo);
+	data.append(track);
+	putVariable(data, time > last ? time - last : 0);
+	put8(data, 0xff);
+	put8(data, 0x2f);
+	put8(data, 0x00);
+
+	vector<uint8_t> out;
+	for (uint n = 0; n < 4; n++) put8(out, "MThd"[n]);
+	put32(out, 6);
+	put16(out, 0);  // format 0
+	put16(out, 1);  // one track
+	put16(out, division);
+	for (uint n = 0; n < 4; n++) put8(out, "MTrk"[n]);
+	put32(out, data.size());
+	out.append(data);
+	return file::write(filename, out);
+}
@@ -2,6 +2,7 @@
 #include <fc/fc.hpp>
 
 struct NSFPlayer : Emulator::Platform {
+	~NSFPlayer();
 	auto run(string filename, Arguments arguments) -> void;
 
 	// Hard-coded manifest.bml for Famicom:
@@ -15,7 +16,7 @@ struct NSFPlayer : Emulator::Platform {
 	file_buffer wave;
 	long samples;
 
-	Famicom::Interface* nes;
+	Famicom::Interface* nes = nullptr;
 
 	Famicom::CPU* cpu;
 	Famicom::APU* apu;
@@ -36,6 +37,11 @@ struct NSFPlayer : Emulator::Platform {
 	auto notify(string text) -> void override;
 };
 
+NSFPlayer::~NSFPlayer() {
+	if (nes) nes->unload();
+	delete nes;
+}
+
 auto NSFPlayer::path(uint id) -> string {
 	return "";
 }
@@ -46,7 +52,7 @@ auto NSFPlayer::open(uint id, string name, vfs::file::mode mode, bool required)
 		// print("platform::open  id = System\n");
 		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
 			// print("platform::open  manifest.bml from memory\n");
-			return vfs::memory::file::open(nes_sys_manifest.data(), nes_sys_manifest.size());
+			return vfs::memory::file::view(nes_sys_manifest.data(), nes_sys_manifest.size());
 		}
 	}
 
@@ -55,10 +61,10 @@ auto NSFPlayer::open(uint id, string name, vfs::file::mode mode, bool required)
 		if(name == "manifest.bml" && mode == vfs::file::mode::read) {
 			// Load the manifest generated from the NSF file:
 			// print("platform::open  manifest.bml from memory\n");
-			return vfs::memory::file::open(manifest.data<uint8_t>(), manifest.size());
+			return vfs::memory::file::view(manifest.data<uint8_t>(), manifest.size());
 		} else if (name == "program.rom" && mode == vfs::file::mode::read) {
 			// print("platform::open  program.rom from memory\n");
-			return vfs::memory::file::open(prgrom.data<uint8_t>(), prgrom.size());
+			return vfs::memory::file::view(prgrom.data<uint8_t>(), prgrom.size());
 		}
 	}
 
@@ -99,6 +105,15 @@ auto NSFPlayer::notify(string text) -> void {
 }
 
 auto NSFPlayer::run(string filename, Arguments arguments) -> void {
+	// APU output; exact resamples every APU tick, blip synthesizes band-limited steps at the
+	// output rate and skips idle ticks in bulk. Faster, but not sample-identical:
+	string apuMode = "exact";
+	arguments.take("--apu", apuMode);
+	if (apuMode != "exact" && apuMode != "blip") {
+		print("Unknown APU mode ", apuMode, "; expected exact or blip\n");
+		return;
+	}
+
 	// Track number (0-based):
 	auto track_s = arguments.take();
 	if (!track_s) {
@@ -106,7 +121,9 @@ auto NSFPlayer::run(string filename, Arguments arguments) -> void {
 	}
 	auto track = track_s.natural();
 
-	auto buf = file::open(filename, file::mode::read);
+	auto input = archive.open(filename);
+	if (!input) return;
+	auto& buf = *input;
 	if (buf.reads(5) != "NESM\x1A") {
 		print("Missing NESM header for NSF!\n");
 		return;
@@ -151,14 +168,14 @@ auto NSFPlayer::run(string filename, Arguments arguments) -> void {
 
 		// No bank switching, just load data straight into PRGROM at addr_load:
 		// print("addr_load: {0}\n", string_format{hex(addr_load - 0x8000, 4)});
-		buf.read({prgrom.data<uint8_t>() + (addr_load - 0x8000), buf.size() - buf.offset()});
+		buf.read({prgrom.data<uint8_t>() + (addr_load - 0x8000), (uint)(buf.size() - buf.offset())});
 	} else {
 		// Skip padding:
 		auto skip = (addr_load & 0x0FFF);
 		// print("skip 0x{0}\n", string_format{hex(skip, 4)});
-		buf.seek(skip, file_buffer::index::relative);
+		buf.seek(skip, vfs::file::index::relative);
 
-		auto size = buf.size() - buf.offset();
+		auto size = (uint)(buf.size() - buf.offset());
 		// Build a PRGROM vector:
 		prgrom.resize(size);
 		prgrom.fill(0xFF);
@@ -174,12 +191,11 @@ auto NSFPlayer::run(string filename, Arguments arguments) -> void {
 	// }
 	// print("\n");
 
-	buf.close();
+	input.reset();
 
 	// Build a temporary manifest for cartridge to load:
 	manifest = "";
 	manifest.append("game\n");
-	manifest.append("  sha256: ", Hash::SHA256(prgrom).digest(), "\n");
 	manifest.append("  label:  ", song_name, "\n");
 	manifest.append("  name:   ", filename, "\n");
 
@@ -188,6 +204,7 @@ auto NSFPlayer::run(string filename, Arguments arguments) -> void {
 	manifest.append("    nsf\n");
 	manifest.append("      init: 0x", hex(addr_init,4), "\n");
 	manifest.append("      play: 0x", hex(addr_play,4), "\n");
+	manifest.append("      speed ntsc=", ntsc_play_speed, " pal=", pal_play_speed, "\n");
 	manifest.append("      bank\n");
 	for (auto i : range(8)) {
 		manifest.append("        map src=0x{0} dest=0x{1}\n", string_format{hex(i+8,1), hex(bankswitch_init[i],2)});
@@ -224,6 +241,13 @@ auto NSFPlayer::run(string filename, Arguments arguments) -> void {
 		print("NES failed load()\n");
 		return;
 	}
+	// Synthesize APU output at the output rate rather than resampling every APU tick, and advance
+	// idle APU ticks in bulk; the NSF board has no expansion audio:
+	Famicom::apu.bandlimited = apuMode == "blip";
+	Famicom::apu.eventDriven = apuMode == "blip";
+	// No video; the NSF board's play timer replaces the PPU thread:
+	Famicom::ppu.disabled = true;
+
 	// print("nes->power()\n");
 	nes->power();
 
@@ -234,9 +258,6 @@ auto NSFPlayer::run(string filename, Arguments arguments) -> void {
 	scheduler = &Famicom::scheduler;
 	nsf = ((Famicom::NSF *)Famicom::cartridge.board);
 
-	// Disable PPU rendering to save performance:
-	ppu->disabled = true;
-
 	// print("Region: {0}\n", string_format{(int)system.region()});
 
 	nsf->song_index = track;
@@ -256,17 +277,13 @@ auto NSFPlayer::run(string filename, Arguments arguments) -> void {
 
 	nsf->playing = true;
 
-	const int header_size = 0x2C;
-
-	wave = file::open("out.wav", file::mode::write);
-	wave.truncate(header_size);
-	wave.seek(header_size);
+	wave = openWave(outputFilename);
 	samples = 0;
 
 	const long play_seconds = 4 * 60;
 	// const long play_seconds = 2 * 60 + 30;
 
-	int plays = 0;
+	long elapsed = 0;  // Microseconds into the current second.
 	int seconds = 0;
 	print("time: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
 	do
@@ -280,55 +297,17 @@ auto NSFPlayer::run(string filename, Arguments arguments) -> void {
 		     hex(cpu->r.s, 2)
 		});
 #endif
+		// Each frame is one play routine period of the NSF board's timer:
 		if (scheduler->enter(Emulator::Scheduler::Mode::SynchronizeMaster) == Emulator::Scheduler::Event::Frame) {
-			// Indicate NMI interrupt if requested by NSF player:
-			if ((nsf->nmiFlags & 1) || (nsf->nmiFlags & 2)) {
-				// print("play\n");
-				cpu->nmiLine(true);
-			}
-
-			plays++;
-			if (plays >= 60) {
+			elapsed += nsf->settings.play_speed;
+			if (elapsed >= 1000000) {
 				seconds++;
-				plays = 0;
+				elapsed -= 1000000;
 				print("\b\b\b\b\b\b\b\b\b\b\b\rtime: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
 			}
 		}
 	} while (seconds < play_seconds);
 	print("\n");
 
-	// Write WAVE headers:
-	long chan_count = 1;
-	long rate = 48000;
-	long ds = samples * sizeof (float);
-	long rs = header_size - 8 + ds;
-	int frame_size = chan_count * sizeof (float);
-	long bps = rate * frame_size;
-
-	unsigned char header [header_size] =
-	{
-		'R','I','F','F',
-		rs,rs>>8,           // length of rest of file
-		rs>>16,rs>>24,
-		'W','A','V','E',
-		'f','m','t',' ',
-		0x10,0,0,0,         // size of fmt chunk
-		// 1,0,                // PCM format
-		3,0,				// float format
-		chan_count,0,       // channel count
-		rate,rate >> 8,     // sample rate
-		rate>>16,rate>>24,
-		bps,bps>>8,         // bytes per second
-		bps>>16,bps>>24,
-		frame_size,0,       // bytes per sample frame
-		32,0,               // bits per sample
-		'd','a','t','a',
-		ds,ds>>8,ds>>16,ds>>24// size of sample data
-		// ...              // sample data
-	};
-
-	wave.seek(0);
-	wave.write({header, header_size});
-
-	wave.close();
+	closeWave(wave, 1, 32, 48000, samples, WaveFormat::Float);
 }
\ No newline at end of file
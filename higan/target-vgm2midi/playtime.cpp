@@ -0,0 +1,32 @@
+// How long a render plays: the length, then a linear fade to silence. Four minutes with no fade
+// unless the file's tags or --length and --fade say otherwise; seconds, or minutes:seconds:
+struct PlayTime {
+	double length = 4 * 60;
+	double fade = 0;
+
+	static auto seconds(const string& text) -> double;
+
+	// Overrides the length and fade with --length and --fade, when given:
+	auto take(Arguments& arguments) -> void;
+
+	auto total() const -> double { return length + fade; }
+	auto gain(double time) const -> double;
+};
+
+auto PlayTime::seconds(const string& text) -> double {
+	double value = 0;
+	for (auto& part : text.split(":")) value = value * 60 + part.real();
+	return value;
+}
+
+auto PlayTime::take(Arguments& arguments) -> void {
+	string text;
+	if (arguments.take("--length", text)) length = seconds(text);
+	if (arguments.take("--fade", text)) fade = seconds(text);
+}
+
+auto PlayTime::gain(double time) const -> double {
+	if (time < length) return 1.0;
+	if (time >= length + fade) return 0.0;
+	return 1.0 - (time - length) / fade;
+}
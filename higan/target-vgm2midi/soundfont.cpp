@@ -0,0 +1,207 @@
+// SoundFont 2 bank writer:
+// Each instrument is a single mono sample with one zone covering the whole keyboard.
+struct SoundFont {
+	// Volume envelope generators, in SF2 units (timecents and centibels of attenuation):
+	struct Envelope {
+		int16_t attack = -12000;
+		int16_t decay = -12000;
+		int16_t sustain = 0;
+		int16_t release = -12000;
+	};
+
+	struct Instrument {
+		string name;
+		uint16_t bank = 0;
+		uint16_t program = 0;
+		vector<int16_t> pcm;
+		uint32_t sampleRate = 32000;
+		uint8_t rootKey = 60;
+		bool looped = false;
+		uint32_t loopStart = 0;  // Loop end is always the end of the sample.
+		Envelope envelope;
+	};
+
+	vector<Instrument> instruments;
+	string name;  // Bank name; the file name when empty.
+
+	static auto timecents(double seconds) -> int16_t {
+		if (seconds <= 0.001) return -12000;
+		return max(-12000, min(8000, (int)round(1200.0 * log2(seconds))));
+	}
+	static auto centibels(double level) -> int16_t {
+		if (level <= 0.00001) return 1440;
+		return max(0, min(1440, (int)round(-200.0 * log10(level))));
+	}
+
+	auto save(string filename) -> bool;
+
+private:
+	// Little-endian chunk building helpers:
+	static auto put8(vector<uint8_t>& out, uint8_t data) -> void { out.append(data); }
+	static auto put16(vector<uint8_t>& out, uint16_t data) -> void { put8(out, data); put8(out, data >> 8); }
+	static auto put32(vector<uint8_t>& out, uint32_t data) -> void { put16(out, data); put16(out, data >> 16); }
+	static auto putName(vector<uint8_t>& out, const string& name, uint length) -> void {
+		for (uint n = 0; n < length; n++) put8(out, n < length - 1 && n < name.size() ? name[n] : 0);
+	}
+	static auto putChunk(vector<uint8_t>& out, const char* id, const vector<uint8_t>& data) -> void {
+		for (uint n = 0; n < 4; n++) put8(out, id[n]);
+		put32(out, data.size());
+		out.append(data);
+		if (data.size() & 1) put8(out, 0);
+	}
+	static auto putList(vector<uint8_t>& out, const char* type, const vector<uint8_t>& data) -> void {
+		vector<uint8_t> list;
+		for (uint n = 0; n < 4; n++) put8(list, type[n]);
+		list.append(data);
+		putChunk(out, "LIST", list);
+	}
+};
+
+auto SoundFont::save(string filename) -> bool {
+	enum : uint16_t {
+		GenAttackVolEnv = 34,
+		GenDecayVolEnv = 36,
+		GenSustainVolEnv = 37,
+		GenReleaseVolEnv = 38,
+		GenInstrument = 41,
+		GenSampleID = 53,
+		GenSampleModes = 54,
+	};
+
+	// Sample data; every sample is followed by 46 zero points as the specification requires:
+	vector<uint8_t> smpl;
+	vector<uint8_t> shdr;
+	uint32_t offset = 0;
+	for (auto& instrument : instruments) {
+		vector<int16_t> pcm = instrument.pcm;
+		uint32_t loopStart = instrument.loopStart;
+		bool looped = instrument.looped && loopStart < pcm.size();
+		if (looped) {
+			// Loops must span at least 32 points, so unroll short ones:
+			uint32_t loopLength = pcm.size() - loopStart;
+			while (pcm.size() - loopStart < 32) {
+				// Copied out first; append() may move the samples it would read from:
+				for (uint32_t n = 0; n < loopLength; n++) { int16_t sample = pcm[loopStart + n]; pcm.append(sample); }
+			}
+		}
+		uint32_t loopEnd = pcm.size();
+		if (looped) {
+			// Guard points after the loop so interpolation sees the wrapped signal:
+			for (uint32_t n = 0; n < 8; n++) { int16_t sample = pcm[loopStart + n % (loopEnd - loopStart)]; pcm.append(sample); }
+		}
+
+		for (auto sample : pcm) put16(smpl, sample);
+		for (uint n = 0; n < 46; n++) put16(smpl, 0);
+
+		putName(shdr, instrument.name, 20);
+		put32(shdr, offset);
+		put32(shdr, offset + loopEnd);
+		put32(shdr, offset + (looped ? loopStart : 0));
+		put32(shdr, offset + (looped ? loopEnd : 0));
+		put32(shdr, instrument.sampleRate);
+		put8(shdr, instrument.rootKey);
+		put8(shdr, 0);   // pitch correction
+		put16(shdr, 0);  // sample link
+		put16(shdr, 1);  // mono sample
+		offset += pcm.size() + 46;
+	}
+	putName(shdr, "EOS", 20);
+	for (uint n = 0; n < 26; n++) put8(shdr, 0);
+
+	// Presets and instruments; one global-less zone each:
+	vector<uint8_t> phdr, pbag, pmod, pgen;
+	vector<uint8_t> inst, ibag, imod, igen;
+	uint16_t pgenIndex = 0, igenIndex = 0;
+	for (uint index = 0; index < instruments.size(); index++) {
+		auto& instrument = instruments[index];
+
+		putName(phdr, instrument.name, 20);
+		put16(phdr, instrument.program);
+		put16(phdr, instrument.bank);
+		put16(phdr, index);  // preset bag index
+		put32(phdr, 0);
+		put32(phdr, 0);
+		put32(phdr, 0);
+
+		put16(pbag, pgenIndex);
+		put16(pbag, 0);
+		put16(pgen, GenInstrument);
+		put16(pgen, index);
+		pgenIndex++;
+
+		putName(inst, instrument.name, 20);
+		put16(inst, index);  // instrument bag index
+
+		put16(ibag, igenIndex);
+		put16(ibag, 0);
+		auto generator = [&](uint16_t oper, int16_t amount) {
+			put16(igen, oper);
+			put16(igen, amount);
+			igenIndex++;
+		};
+		generator(GenAttackVolEnv, instrument.envelope.attack);
+		generator(GenDecayVolEnv, instrument.envelope.decay);
+		generator(GenSustainVolEnv, instrument.envelope.sustain);
+		generator(GenReleaseVolEnv, instrument.envelope.release);
+		if (instrument.looped) generator(GenSampleModes, 1);
+		// sampleID must be the last generator in a zone:
+		generator(GenSampleID, index);
+	}
+
+	// Terminal records:
+	putName(phdr, "EOP", 20);
+	put16(phdr, 0);
+	put16(phdr, 0);
+	put16(phdr, instruments.size());
+	put32(phdr, 0);
+	put32(phdr, 0);
+	put32(phdr, 0);
+	put16(pbag, pgenIndex);
+	put16(pbag, 0);
+	for (uint n = 0; n < 10; n++) put8(pmod, 0);
+	put32(pgen, 0);
+
+	putName(inst, "EOI", 20);
+	put16(inst, instruments.size());
+	put16(ibag, igenIndex);
+	put16(ibag, 0);
+	for (uint n = 0; n < 10; n++) put8(imod, 0);
+	put32(igen, 0);
+
+	// INFO list:
+	vector<uint8_t> ifil, isng, inam;
+	put16(ifil, 2);
+	put16(ifil, 1);
+	putName(isng, "EMU8000", 8);
+	string bankName = name ? name : Location::prefix(filename);
+	putName(inam, bankName, bankName.size() + 2 & ~1);
+
+	vector<uint8_t> info;
+	putChunk(info, "ifil", ifil);
+	putChunk(info, "isng", isng);
+	putChunk(info, "INAM", inam);
+
+	vector<uint8_t> sdta;
+	putChunk(sdta, "smpl", smpl);
+
+	vector<uint8_t> pdta;
+	putChunk(pdta, "phdr", phdr);
+	putChunk(pdta, "pbag", pbag);
+	putChunk(pdta, "pmod", pmod);
+	putChunk(pdta, "pgen", pgen);
+	putChunk(pdta, "inst", inst);
+	putChunk(pdta, "ibag", ibag);
+	putChunk(pdta, "imod", imod);
+	putChunk(pdta, "igen", igen);
+	putChunk(pdta, "shdr", shdr);
+
+	vector<uint8_t> sfbk;
+	for (uint n = 0; n < 4; n++) put8(sfbk, "sfbk"[n]);
+	putList(sfbk, "INFO", info);
+	putList(sfbk, "sdta", sdta);
+	putList(sfbk, "pdta", pdta);
+
+	vector<uint8_t> riff;
+	putChunk(riff, "RIFF", sfbk);
+	return file::write(filename, riff);
+}
@@ -2,23 +2,46 @@
 #include <sfc/sfc.hpp>
 
 struct SPCPlayer : Emulator::Platform {
+	~SPCPlayer();
 	auto run(string filename, Arguments arguments) -> void;
 
-	// Generated manfiest and supporting data for SPC file:
-	string manifest;
+	// Supporting data for SPC file; the RAM and DSP registers are read in place:
 	vector<uint8_t> spcregs;
-	vector<uint8_t> dspram;
-	vector<uint8_t> dspregs;
+	array_view<uint8_t> dspram;
+	array_view<uint8_t> dspregs;
 	vector<uint8_t> iplrom;
 
+	// ID666 tags, with the extended xid6 ones over them; times are in seconds:
+	struct Tags {
+		string title, game, artist, dumper, comments;
+		double length = 0;  // Play time before the fade.
+		double fade = 0;
+		double intro = 0, loop = 0, end = 0;
+		uint loops = 0;
+		uint8_t muted = 0;  // Voices left out of the mix; d0 = voice 0.
+	} tags;
+	auto parseID666(vfs::file& buf) -> void;
+	auto parseXID6(vfs::file& buf) -> void;
+
+	// Length and fade of the render:
+	PlayTime playTime;
+
+	// Instrument export; one record per SRCN heard during playback:
+	struct Source {
+		bool used = false;
+		uint8_t adsr0, adsr1, gain;
+	} sources[256];
+	auto trackSources() -> void;
+	auto decodeSource(uint8_t srcn, SoundFont::Instrument& instrument) -> bool;
+	auto sourceEnvelope(const Source& source) -> SoundFont::Envelope;
+	auto exportInstruments(string filename) -> void;
+
 	// WAVE file writing out:
 	file_buffer wave;
 	long samples;
 
-	SuperFamicom::Interface* snes;
+	SuperFamicom::Interface* snes = nullptr;
 
-	SuperFamicom::CPU* cpu;
-	SuperFamicom::PPU* ppu;
 	SuperFamicom::SMP* smp;
 	SuperFamicom::DSP* dsp;
 	SuperFamicom::System* system;
@@ -36,34 +59,21 @@ struct SPCPlayer : Emulator::Platform {
 	auto notify(string text) -> void override;
 };
 
+SPCPlayer::~SPCPlayer() {
+	if (snes) snes->unload();
+	delete snes;
+}
+
 auto SPCPlayer::path(uint id) -> string {
 	return "";
 }
 auto SPCPlayer::open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file {
 	// print("platform::open({0}, {1})\n", string_format{id, name});
 
+	// The APU-only system loads no cartridge; only the IPL ROM is requested:
 	if (id == 0) {  //System
-		if (name == "boards.bml" && mode == vfs::file::mode::read) {
-			return vfs::memory::file::open(Resource::System::Boards, sizeof(Resource::System::Boards));
-		}
-
 		if (name == "ipl.rom" && mode == vfs::file::mode::read) {
-			return vfs::memory::file::open(Resource::System::IPLROM, sizeof(Resource::System::IPLROM));
-		}
-	}
-
-	if (id == 1) {  //Super Famicom
-		// print("platform::open  id = Super Famicom\n");
-		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
-			// Load the manifest generated from the SPC file:
-			// print("platform::open  manifest.bml from memory\n");
-			return vfs::memory::file::open(manifest.data<uint8_t>(), manifest.size());
-		} else if (name == "program.rom" && mode == vfs::file::mode::read) {
-			// print("platform::open  program.rom from memory\n");
-			return vfs::memory::file::open(0, 0);
-		} else {
-			// print("platform::open null response\n");
-			return {};
+			return vfs::memory::file::view(Resource::System::IPLROM, sizeof(Resource::System::IPLROM));
 		}
 	}
 
@@ -82,9 +92,12 @@ auto SPCPlayer::audioSample(const double* samples, uint channels) -> void {
 	// For SPC:
 	assert(channels == 2);
 
+	// Fade out linearly after the length:
+	double gain = playTime.gain(this->samples / 48000.0);
+
 	// Write 16-bit samples:
-	auto x = (int16_t)(samples[0] * 32767.0);
-	auto y = (int16_t)(samples[1] * 32767.0);
+	auto x = (int16_t)(samples[0] * gain * 32767.0);
+	auto y = (int16_t)(samples[1] * gain * 32767.0);
 	wave.write({&x, sizeof(int16_t)});
 	wave.write({&y, sizeof(int16_t)});
 	this->samples++;
@@ -100,8 +113,300 @@ auto SPCPlayer::notify(string text) -> void {
 	print("notify(\"{0}\")\n", string_format{text});
 }
 
+auto SPCPlayer::trackSources() -> void {
+	// Record each SRCN while a voice is audible, with the envelope settings it is played with:
+	for (uint v = 0; v < 8; v++) {
+		if (!dsp->read(v << 4 | 0x08)) continue;  // ENVX
+		auto& source = sources[dsp->read(v << 4 | 0x04)];
+		if (source.used) continue;
+		source.used = true;
+		source.adsr0 = dsp->read(v << 4 | 0x05);
+		source.adsr1 = dsp->read(v << 4 | 0x06);
+		source.gain = dsp->read(v << 4 | 0x07);
+	}
+}
+
+auto SPCPlayer::decodeSource(uint8_t srcn, SoundFont::Instrument& instrument) -> bool {
+	// Source directory entry: start address, then loop address:
+	auto& ram = dsp->apuram;
+	uint16_t entry = (dsp->read(0x5d) << 8) + (srcn << 2);  // DIR
+	uint16_t start = ram[entry + 0] | ram[(uint16_t)(entry + 1)] << 8;
+	uint16_t loop = ram[(uint16_t)(entry + 2)] | ram[(uint16_t)(entry + 3)] << 8;
+
+	// Decode the BRR chain up to its end block, the same way the S-DSP does:
+	instrument.pcm.reset();
+	instrument.looped = false;
+	int p1 = 0, p2 = 0;
+	uint16_t address = start;
+	for (uint blocks = 0; blocks < 0x10000 / 9; blocks++) {
+		if (address == loop) instrument.loopStart = instrument.pcm.size(), instrument.looped = true;
+
+		uint8_t header = ram[address];
+		const int filter = (header >> 2) & 3;
+		const int scale = header >> 4;
+		for (uint n = 0; n < 16; n++) {
+			uint8_t byte = ram[(uint16_t)(address + 1 + (n >> 1))];
+			int s = (int8_t)(n & 1 ? byte << 4 : byte) >> 4;
+			if (scale <= 12) {
+				s <<= scale;
+				s >>= 1;
+			} else {
+				s &= ~0x7ff;
+			}
+
+			const int h1 = p1, h2 = p2 >> 1;
+			switch (filter) {
+			case 1: s += h1 >> 1; s += (-h1) >> 5; break;
+			case 2: s += h1; s -= h2; s += h2 >> 4; s += (h1 * -3) >> 6; break;
+			case 3: s += h1; s -= h2; s += (h1 * -13) >> 7; s += (h2 * 3) >> 4; break;
+			}
+
+			s = sclamp<16>(s);
+			s = (int16_t)(s << 1);
+			instrument.pcm.append(s);
+			p2 = p1;
+			p1 = s;
+		}
+
+		if (header & 1) {
+			// End flag; the loop flag decides whether the voice continues at the loop address:
+			instrument.looped = instrument.looped && (header & 2);
+			return true;
+		}
+		address += 9;
+	}
+
+	// No end block; not a valid sample:
+	return false;
+}
+
+auto SPCPlayer::sourceEnvelope(const Source& source) -> SoundFont::Envelope {
+	// Seconds for a given number of envelope steps at an S-DSP counter rate; zero means never:
+	auto seconds = [](uint rate, double steps) -> double {
+		static const uint16_t counterRate[32] = {
+			   0, 2048, 1536, 1280, 1024,  768,  640,  512,
+			 384,  320,  256,  192,  160,  128,   96,   80,
+			  64,   48,   40,   32,   24,   20,   16,   12,
+			  10,    8,    6,    5,    4,    3,    2,    1,
+		};
+		return counterRate[rate & 31] * steps / 32000.0;
+	};
+	// Exponential decrease loses 1/256th per step, so it takes about 2950 steps to fall by 100dB,
+	// which is how SF2 specifies decay time:
+	const double exponentialSteps = 100.0 / (20.0 * log10(256.0 / 255.0));
+
+	SoundFont::Envelope envelope;
+	// Key off always decreases linearly by 8 per sample, 256 samples from full volume:
+	envelope.release = SoundFont::timecents(256 / 32000.0);
+
+	if (source.adsr0 & 0x80) {
+		uint attackRate = (source.adsr0 & 0x0f) * 2 + 1;
+		uint decayRate = ((source.adsr0 >> 4) & 7) * 2 + 16;
+		uint sustainLevel = source.adsr1 >> 5;
+		uint sustainRate = source.adsr1 & 0x1f;
+
+		envelope.attack = SoundFont::timecents(seconds(attackRate, attackRate < 31 ? 64 : 2));
+		if (sustainRate) {
+			// SF2 sustain is flat, so a decaying sustain phase becomes a decay to silence:
+			envelope.decay = SoundFont::timecents(seconds(sustainRate, exponentialSteps));
+			envelope.sustain = SoundFont::centibels(0.0);
+		} else {
+			envelope.decay = SoundFont::timecents(seconds(decayRate, exponentialSteps));
+			envelope.sustain = SoundFont::centibels((sustainLevel + 1) / 8.0);
+		}
+	} else if (source.gain < 0x80) {
+		// Direct gain; a fixed volume:
+		envelope.sustain = SoundFont::centibels((source.gain & 0x7f) / 127.0);
+	} else {
+		uint mode = (source.gain >> 5) & 3;
+		uint rate = source.gain & 0x1f;
+		if (!rate) {
+			// The envelope never moves; assume it was left at full volume.
+		} else if (mode == 0) {  // linear decrease
+			envelope.decay = SoundFont::timecents(seconds(rate, 64));
+			envelope.sustain = SoundFont::centibels(0.0);
+		} else if (mode == 1) {  // exponential decrease
+			envelope.decay = SoundFont::timecents(seconds(rate, exponentialSteps));
+			envelope.sustain = SoundFont::centibels(0.0);
+		} else if (mode == 2) {  // linear increase
+			envelope.attack = SoundFont::timecents(seconds(rate, 64));
+		} else {  // two-slope linear increase
+			envelope.attack = SoundFont::timecents(seconds(rate, 0x600 / 0x20 + 0x200 / 0x08));
+		}
+	}
+	return envelope;
+}
+
+auto SPCPlayer::exportInstruments(string filename) -> void {
+	SoundFont soundfont;
+	// The bank is named after the song, when the tags name it:
+	if (tags.title) soundfont.name = tags.game ? string{tags.game, " - ", tags.title} : tags.title;
+	for (uint srcn = 0; srcn < 256; srcn++) {
+		if (!sources[srcn].used) continue;
+
+		SoundFont::Instrument instrument;
+		if (!decodeSource(srcn, instrument)) continue;
+
+		// Programs are SRCN numbers; SRCNs past 127 continue in bank 1:
+		instrument.name = {"SRCN ", pad(srcn, 3, '0')};
+		instrument.bank = srcn >> 7;
+		instrument.program = srcn & 0x7f;
+		// Pitch register $1000 plays the sample back at 32kHz:
+		instrument.sampleRate = 32000;
+		instrument.rootKey = 60;
+		instrument.envelope = sourceEnvelope(sources[srcn]);
+		soundfont.instruments.append(instrument);
+	}
+
+	if (!soundfont.save(filename)) {
+		print("Failed to write ", filename, "\n");
+		return;
+	}
+	print("Exported ", soundfont.instruments.size(), " instruments to ", filename, "\n");
+}
+
+auto SPCPlayer::parseID666(vfs::file& buf) -> void {
+	vector<uint8_t> id666;
+	id666.resize(0x100 - 0x2E);
+	buf.seek(0x2E);
+	buf.read(id666);
+
+	// Fields are addressed by their offset in the file:
+	auto field = [&](uint offset) -> const uint8_t* { return id666.data() + offset - 0x2E; };
+	auto text = [&](uint offset, uint length) -> string {
+		string s;
+		for (uint n = 0; n < length && field(offset)[n]; n++) s.append((char)field(offset)[n]);
+		return s.strip();
+	};
+	auto number = [&](uint offset, uint length) -> uint {
+		uint value = 0;
+		for (uint n = 0; n < length && field(offset)[n]; n++) value = value * 10 + (field(offset)[n] - '0');
+		return value;
+	};
+	auto binary = [&](uint offset, uint length) -> uint {
+		uint value = 0;
+		for (uint n = length; n > 0; n--) value = value << 8 | field(offset)[n - 1];
+		return value;
+	};
+
+	tags.title = text(0x2E, 32);
+	tags.game = text(0x4E, 32);
+	tags.dumper = text(0x6E, 16);
+	tags.comments = text(0x7E, 32);
+
+	// The text and binary layouts differ from the play time on, and nothing says which is used.
+	// Either the date settles it, MM/DD/YYYY as text or day, month and a 16-bit year as binary,
+	// or the play and fade times do, which are only ever digits as text:
+	bool timesText = true, timesEmpty = true;
+	for (uint offset = 0xA9; offset <= 0xB0; offset++) {
+		auto c = *field(offset);
+		if (c) timesEmpty = false;
+		if (c && (c < '0' || c > '9')) timesText = false;
+	}
+	bool dateText = *field(0xA0) == '/' && *field(0xA3) == '/';
+	bool dateBinary = false;
+	for (uint offset = 0x9E; offset <= 0xA8; offset++) {
+		auto c = *field(offset);
+		if (c && (c < 0x20 || c > 0x7E)) dateBinary = true;
+	}
+
+	enum class Layout : uint { Unknown, Text, Binary } layout = Layout::Unknown;
+	bool certain = true;
+	if (!timesText) layout = Layout::Binary, certain = !dateText;
+	else if (dateText) layout = Layout::Text, certain = !dateBinary;
+	else if (dateBinary) layout = Layout::Binary;
+	else {
+		// Only a guess from here; a digit-only binary time, or no times at all, looks like text.
+		// The artist starts at $B0 as binary, where the text fade time ends:
+		certain = false;
+		if (!timesEmpty) layout = Layout::Text;
+		else if (*field(0xB0)) layout = Layout::Binary;
+		else if (*field(0xB1)) layout = Layout::Text;
+	}
+
+	if (layout == Layout::Text) {
+		tags.length = number(0xA9, 3);
+		tags.fade = number(0xAC, 5) / 1000.0;
+		tags.artist = text(0xB1, 32);
+	} else if (layout == Layout::Binary) {
+		tags.length = binary(0xA9, 3);
+		tags.fade = binary(0xAC, 4) / 1000.0;
+		tags.artist = text(0xB0, 32);
+	}
+
+	// A guessed layout could take the other's emulator byte for the muted voices:
+	if (certain) tags.muted = *field(layout == Layout::Text ? 0xD1 : 0xD0);
+}
+
+auto SPCPlayer::parseXID6(vfs::file& buf) -> void {
+	// The extended chunk follows the RAM, DSP registers and IPL ROM:
+	if (buf.size() < 0x10208) return;
+	buf.seek(0x10200);
+	if (buf.reads(4) != "xid6") return;
+	uint64_t end = min(buf.size(), 0x10208 + buf.readl(4));
+
+	while (buf.offset() + 4 <= end) {
+		uint8_t id = buf.read();
+		uint8_t type = buf.read();
+		uint16_t data = buf.readl(2);
+
+		// Type 0 keeps its value in the header; the others are followed by data padded to 32 bits:
+		string s;
+		uint32_t value = data;
+		if (type != 0) {
+			auto next = buf.offset() + (data + 3 & ~3);
+			if (next > end) break;
+			if (type == 1) {
+				for (uint n = 0; n < data; n++) {
+					char c = buf.read();
+					if (c) s.append(c);
+				}
+				s.strip();
+			} else {
+				value = buf.readl(min(data, 4));
+			}
+			buf.seek(next);
+		}
+
+		// Lengths are in ticks of 1/64000th of a second:
+		switch (id) {
+		case 0x01: tags.title = s; break;
+		case 0x02: tags.game = s; break;
+		case 0x03: tags.artist = s; break;
+		case 0x04: tags.dumper = s; break;
+		case 0x07: tags.comments = s; break;
+		case 0x30: tags.intro = value / 64000.0; break;
+		case 0x31: tags.loop = value / 64000.0; break;
+		case 0x32: tags.end = value / 64000.0; break;
+		case 0x33: tags.fade = value / 64000.0; break;
+		case 0x34: tags.muted = value; break;
+		case 0x35: tags.loops = value; break;
+		}
+	}
+}
+
 auto SPCPlayer::run(string filename, Arguments arguments) -> void {
-	auto buf = file::open(filename, file::mode::read);
+	// Optional SoundFont 2 export of the instruments heard:
+	string soundfontFilename;
+	if (arguments.take("--sf2", soundfontFilename)) soundfontFilename = outputName(soundfontFilename);
+
+	// DSP mode; fast and batched run the SPC700 once per sample instead of every few clocks:
+	string dspMode;
+	arguments.take("--dsp", dspMode);
+
+	// Length and fade override the tags; seconds, or minutes:seconds:
+	string length_s, fade_s;
+	arguments.take("--length", length_s);
+	arguments.take("--fade", fade_s);
+
+	// Name the output after the game and song title in the tags, rather than out.wav:
+	bool tagNames = false;
+	arguments.take("--tag-names", tagNames);
+
+	auto data = archive.map(filename);
+	if (!data) return;
+	auto input = vfs::memory::file::view(data.data(), data.size());
+	auto& buf = *input;
 	if (buf.reads(33+2) != "SNES-SPC700 Sound File Data v0.30\x1A\x1A") {
 		print("Missing header for SPC!\n");
 		return;
@@ -118,64 +423,58 @@ auto SPCPlayer::run(string filename, Arguments arguments) -> void {
 	spcregs.resize(0x2C - 0x25);
 	buf.read(spcregs);
 
-	// Jump to real data:
-	buf.seek(0x100);
-
-	// An SPC dump is just a dump of SPC ram at the time of song init:
-	dspram.resize(0x10000);
-	dspram.fill(0x00);
-	buf.read(dspram);
+	// The ID666 tags sit between the registers and the RAM:
+	tags = {};
+	if (hasID666) parseID666(buf);
 
-	// And the SPC700 DSP registers:
-	dspregs.resize(0x80);
-	dspregs.fill(0x00);
-	buf.read(dspregs);
+	// An SPC dump is just a dump of SPC ram at the time of song init, and the SPC700 DSP registers:
+	if (data.size() < 0x10180) {
+		print("Truncated SPC!\n");
+		return;
+	}
+	dspram = data.view(0x100, 0x10000);
+	dspregs = data.view(0x10100, 0x80);
 
-	buf.seek(64, file_buffer::index::relative);
+	buf.seek(0x101C0);
 	iplrom.resize(64);
 	buf.read(iplrom);
 
-	auto song_name = "";
-
-	buf.close();
+	parseXID6(buf);
 
-	// Build a temporary manifest for cartridge to load:
-	manifest = "";
-	manifest.append("game\n");
-	manifest.append("  sha256: ", Hash::SHA256(dspram).digest(), "\n");
-	manifest.append("  label:  ", song_name, "\n");
-	manifest.append("  name:   ", filename, "\n");
-	manifest.append("  region: ", "NTSC", "\n");
+	input.reset();
 
-	manifest.append("  board:  SPC-MIDI\n");
+	if (tags.title) print("Title:    ", tags.title, "\n");
+	if (tags.game) print("Game:     ", tags.game, "\n");
+	if (tags.artist) print("Artist:   ", tags.artist, "\n");
+	if (tags.dumper) print("Dumper:   ", tags.dumper, "\n");
+	if (tags.comments) print("Comments: ", tags.comments, "\n");
 
-	// print(manifest, "\n");
-
-	// print("Song:      ", song_name, "\n");
-	// print("Artist:    ", artist_name, "\n");
-	// print("Copyright: ", copyright_name, "\n");
-	// print("song count: {0}, start: {1}\n", string_format{song_count, start_song});
+	// The xid6 intro, loop and end times make up the length when given; the ID666 play time otherwise.
+	// Untagged songs play for four minutes, with no fade:
+	double length = tags.length;
+	if (tags.intro || tags.loop || tags.end) {
+		length = tags.intro + tags.loop * (tags.loops ? tags.loops : 1) + tags.end;
+	}
+	if (length) playTime = {length, tags.fade};
+	if (length_s) playTime.length = PlayTime::seconds(length_s);
+	if (fade_s) playTime.fade = PlayTime::seconds(fade_s);
+	print("length: {0}s, fade: {1}s\n", string_format{playTime.length, playTime.fade});
 
 	Emulator::audio.setFrequency(48000);
 	Emulator::audio.setVolume(1.0);
 	Emulator::audio.setBalance(0.0);
 
 	// Grab a hold of the instantied SNES components:
-	cpu = &SuperFamicom::cpu;
-	ppu = &SuperFamicom::ppu;
 	smp = &SuperFamicom::smp;
 	dsp = &SuperFamicom::dsp;
 	system = &SuperFamicom::system;
 	scheduler = &SuperFamicom::scheduler;
 
-	// We don't actually need the CPU to do anything for SPC playing:
-	cpu->disabled = true;
-	ppu->disabled = true;
-
-	// Load and power up the system:
+	// Load and power up only the S-SMP and S-DSP; the SPC snapshot supplies their state:
 	snes = new SuperFamicom::Interface;
-	// Enable fast DSP mode:
-	snes->configure("Hacks/FastDSP/Enable", false);
+	snes->configure("System/APUOnly", true);
+	snes->configure("Hacks/FastDSP/Enable", dspMode == "fast" || dspMode == "batched");
+	snes->configure("Hacks/FastDSP/Batched", dspMode == "batched");
 
 	// print("snes->load()\n");
 	if (!snes->load()) {
@@ -187,6 +486,7 @@ auto SPCPlayer::run(string filename, Arguments arguments) -> void {
 
 	// Load SPC and DSP state:
 	smp->loadDump(dspram, dspregs);
+	dsp->voiceMute = tags.muted;
 
 	// Load SPC regs:
 	smp->r.pc.byte.l = spcregs[0];
@@ -199,23 +499,31 @@ auto SPCPlayer::run(string filename, Arguments arguments) -> void {
 
 	// print("SPC state loaded\n");
 
-	const int header_size = 0x2C;
+	string waveFilename = outputFilename;
+	if (tagNames && tags.title) {
+		// Characters that cannot appear in file names are replaced:
+		string name = tags.game ? string{tags.game, " - ", tags.title} : tags.title;
+		for (auto& c : name) {
+			if (c < 0x20 || strchr("/\\:*?\"<>|", c)) c = '_';
+		}
+		waveFilename = {name, ".wav"};
+	}
+	print("output: ", waveFilename, "\n");
 
-	wave = file::open("out.wav", file::mode::write);
-	wave.truncate(header_size);
-	wave.seek(header_size);
+	wave = openWave(waveFilename);
 	samples = 0;
 
-	const long play_seconds = 4 * 60;
-	// const long play_seconds = 15;
-
-	const long totalCycles = (long)system->apuFrequency() * 16 / 768;
+	long rate = 48000;
+	const long play_samples = (long)(playTime.total() * rate);
+	const long play_seconds = (play_samples + rate - 1) / rate;
 
+	// Play by output time rather than by instruction count; the S-SMP may
+	// consume whole timer polling loops in a single instruction step:
 	int seconds = 0;
 	print("time: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
 	for (; seconds < play_seconds; seconds++)
 	{
-		for (long cycles = 0; cycles < totalCycles; cycles++) {
+		while (samples < min((seconds + 1) * rate, play_samples)) {
 			#if 0
 			print("pc={0} x={1} y={2} a={3} s={4}\n", string_format{
 				hex(smp->r.pc.w,4),
@@ -226,43 +534,13 @@ auto SPCPlayer::run(string filename, Arguments arguments) -> void {
 			});
 			#endif
 			scheduler->enter(Emulator::Scheduler::Mode::SynchronizeMaster);
+			if (soundfontFilename) trackSources();
 		}
 		print("\b\b\b\b\b\b\b\b\b\b\b\rtime: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
 	}
 	print("\n");
 
-	// Write WAVE headers:
-	long chan_count = 2;
-	long rate = 48000;
-	long ds = samples * sizeof (int16_t);
-	long rs = header_size - 8 + ds;
-	int frame_size = chan_count * sizeof (int16_t);
-	long bps = rate * frame_size;
-
-	unsigned char header [header_size] =
-	{
-		'R','I','F','F',
-		rs,rs>>8,           // length of rest of file
-		rs>>16,rs>>24,
-		'W','A','V','E',
-		'f','m','t',' ',
-		0x10,0,0,0,         // size of fmt chunk
-		1,0,                // PCM format
-		// 3,0,				// float format
-		chan_count,0,       // channel count
-		rate,rate >> 8,     // sample rate
-		rate>>16,rate>>24,
-		bps,bps>>8,         // bytes per second
-		bps>>16,bps>>24,
-		frame_size,0,       // bytes per sample frame
-		16,0,               // bits per sample
-		'd','a','t','a',
-		ds,ds>>8,ds>>16,ds>>24// size of sample data
-		// ...              // sample data
-	};
-
-	wave.seek(0);
-	wave.write({header, header_size});
+	closeWave(wave, 2, 16, rate, samples);
 
-	wave.close();
+	if (soundfontFilename) exportInstruments(soundfontFilename);
 }
\ No newline at end of file
@@ -1,29 +1,88 @@
 #include "vgm2midi.hpp"
 
+// WAVE output; out.wav, or named after each track in batch mode:
+string outputFilename = "out.wav";
+bool batchMode = false;
+
+// Other outputs, such as --midi and --sf2 files; as given, or in batch mode named after the track's
+// WAVE output so that tracks do not overwrite each other. "sub/a.gsf" writes "sub_a.gsf.wav" and "sub_a.gsf.fifo_a.wav":
+auto outputName(const string& name) -> string {
+	if (!batchMode) return name;
+	return {Location::notsuffix(outputFilename), ".", Location::file(name)};
+}
+
+#include "archive.cpp"
+#include "wave.cpp"
+#include "playtime.cpp"
+#include "soundfont.cpp"
+#include "midi.cpp"
+#include "fmtranscriber.cpp"
 #include "nsfplayer.cpp"
 #include "spcplayer.cpp"
+#include "vgmplayer.cpp"
+#include "gbsplayer.cpp"
+#include "hesplayer.cpp"
+#include "gsfplayer.cpp"
+#include "wsrplayer.cpp"
+
+// Plays a file with the player for its type; false when the type is not known:
+auto play(string filename, Arguments arguments) -> bool {
+	auto df = string{filename}.downcase();
+
+	// Each track gets its own player, which unloads its system when deleted:
+	auto run = [&](auto player) {
+		platform = player;
+		player->run(filename, arguments);
+		delete player;
+		platform = nullptr;
+	};
+
+	if (df.endsWith(".nsf")) {
+		run(new NSFPlayer);
+	} else if (df.endsWith(".spc") || df.endsWith(".spcz")) {
+		run(new SPCPlayer);
+	} else if (df.endsWith(".vgm") || df.endsWith(".vgz")) {
+		run(new VGMPlayer);
+	} else if (df.endsWith(".gbs")) {
+		run(new GBSPlayer);
+	} else if (df.endsWith(".hes")) {
+		run(new HESPlayer);
+	} else if (df.endsWith(".gsf") || df.endsWith(".minigsf")) {
+		run(new GSFPlayer);
+	} else if (df.endsWith(".wsr")) {
+		run(new WSRPlayer);
+	} else {
+		return false;
+	}
+	return true;
+}
 
 // Main:
 #include <nall/main.hpp>
 auto nall::main(Arguments arguments) -> void {
-	// NSF filename:
+	// Input filename; a file, a member of a zip archive as "game.zip:track.spc", or a whole archive:
 	auto filename = arguments.take();
 	if (!filename) {
 		print("Missing filename\n");
 		return;
 	}
 
-	auto df = filename.downcase();
+	if (Archive::isArchive(filename)) {
+		// Batch mode; every track in the archive is played, each to a WAVE file named after
+		// the whole member name, so that tracks of different types or folders stay apart:
+		batchMode = true;
+		uint played = 0;
+		for (auto& location : archive.members(filename)) {
+			auto member = slice(location, filename.size() + 1);
+			outputFilename = {string{member}.replace("/", "_"), ".wav"};
+			print("[", member, "]\n");
+			if (play(location, arguments)) played++;
+		}
+		print("Played ", played, " tracks from ", filename, "\n");
+		return;
+	}
 
-	if (df.endsWith(".nsf")) {
-		auto nsfplayer = new NSFPlayer;
-		platform = nsfplayer;
-		nsfplayer->run(filename, arguments);
-	} else if (df.endsWith(".spc")) {
-		auto spcplayer = new SPCPlayer;
-		platform = spcplayer;
-		spcplayer->run(filename, arguments);
-	} else {
+	if (!play(filename, arguments)) {
 		print("Unrecognized file extension\n");
 		return;
 	}
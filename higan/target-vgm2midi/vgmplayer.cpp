@@ -0,0 +1,325 @@
+#include <md/md.hpp>
+
+struct VGMPlayer : Emulator::Platform {
+	~VGMPlayer();
+	auto run(string filename, Arguments arguments) -> void;
+
+	// VGM command stream; read in place, or inflated when the file is a VGZ:
+	array_view<uint8_t> vgm;
+	uint position = 0;
+
+	// YM2612 PCM data bank (data block type $00) and the read offset used by commands $80-$8F:
+	vector<uint8_t> pcm;
+	uint pcmOffset = 0;
+
+	string region;
+
+	// Stream time in scheduler clock units; each VGM wait sample is 1/44100th of a second:
+	uintmax clock = 0;
+	uintmax waitScalar = 0;
+	long elapsed = 0;  // VGM samples played.
+
+	// Optional MIDI transcription of the YM2612 writes; without audio, the chips are not run at all:
+	FMTranscriber* transcriber = nullptr;
+	bool render = true;
+
+	auto read8() -> uint8_t;
+	auto read16() -> uint16_t;
+	auto read32() -> uint32_t;
+	auto execute() -> int;
+	auto writeYM2612(uint9 address, uint8_t data) -> void;
+	auto advance(uint waits) -> void;
+
+	// WAVE file writing out:
+	file_buffer wave;
+	long samples;
+
+	MegaDrive::Interface* md = nullptr;
+
+	MegaDrive::YM2612* ym2612;
+	MegaDrive::PSG* psg;
+
+	// Emulator::Platform
+	auto path(uint id) -> string override;
+	auto open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file override;
+	auto load(uint id, string name, string type, vector<string> options = {}) -> Emulator::Platform::Load override;
+	auto videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void override;
+	auto audioSample(const double* samples, uint channels) -> void override;
+	auto inputPoll(uint port, uint device, uint input) -> int16 override;
+	auto inputRumble(uint port, uint device, uint input, bool enable) -> void override;
+	auto dipSettings(Markup::Node node) -> uint override;
+	auto notify(string text) -> void override;
+};
+
+VGMPlayer::~VGMPlayer() {
+	if (md) md->unload();
+	delete md;
+	delete transcriber;
+}
+
+auto VGMPlayer::path(uint id) -> string {
+	return "";
+}
+auto VGMPlayer::open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file {
+	// The sound-only system loads no files:
+	if (required) {
+		print("platform::open  Missing required file {0}\n", string_format{name});
+	}
+
+	return {};
+}
+auto VGMPlayer::load(uint id, string name, string type, vector<string> options) -> Emulator::Platform::Load {
+	// The region decides the master clock the YM2612 and PSG clocks are divided from:
+	return {id, region};
+}
+auto VGMPlayer::videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void {
+}
+auto VGMPlayer::audioSample(const double* samples, uint channels) -> void {
+	// YM2612 is stereo, so the mix is too:
+	assert(channels == 2);
+
+	// Write 16-bit samples:
+	auto x = (int16_t)(samples[0] * 32767.0);
+	auto y = (int16_t)(samples[1] * 32767.0);
+	wave.write({&x, sizeof(int16_t)});
+	wave.write({&y, sizeof(int16_t)});
+	this->samples++;
+}
+auto VGMPlayer::inputPoll(uint port, uint device, uint input) -> int16 {
+	return 0;
+}
+auto VGMPlayer::inputRumble(uint port, uint device, uint input, bool enable) -> void {}
+auto VGMPlayer::dipSettings(Markup::Node node) -> uint {
+	return 0;
+}
+auto VGMPlayer::notify(string text) -> void {
+	print("notify(\"{0}\")\n", string_format{text});
+}
+
+// Little-endian stream reads; past the end of the data they read zeroes, which is not a valid command:
+auto VGMPlayer::read8() -> uint8_t {
+	return position < vgm.size() ? vgm[position++] : 0;
+}
+auto VGMPlayer::read16() -> uint16_t {
+	uint16_t data = read8();
+	return data | read8() << 8;
+}
+auto VGMPlayer::read32() -> uint32_t {
+	uint32_t data = read16();
+	return data | read16() << 16;
+}
+
+// Runs one command and returns the number of samples to wait after it, or -1 at the end of the data:
+auto VGMPlayer::execute() -> int {
+	auto command = read8();
+
+	// Waits:
+	if (command == 0x61) return read16();
+	if (command == 0x62) return 735;
+	if (command == 0x63) return 882;
+	if ((command & 0xf0) == 0x70) return (command & 15) + 1;
+
+	// Chip writes:
+	if (command == 0x4f) {
+		read8();  // Game Gear stereo; the PSG core is mono.
+		return 0;
+	}
+	if (command == 0x50) {
+		auto data = read8();
+		if (render) psg->write(data);
+		return 0;
+	}
+	if (command == 0x52 || command == 0x53) {
+		auto address = read8();
+		auto data = read8();
+		writeYM2612((command & 1) << 8 | address, data);
+		return 0;
+	}
+
+	// PCM data bank for the YM2612 DAC:
+	if (command == 0x67) {
+		read8();  // $66 compatibility byte
+		auto type = read8();
+		auto size = read32();
+		auto offset = position;
+		position = min((uint64_t)vgm.size(), (uint64_t)position + size);
+		if (type == 0x00) {
+			for (uint n = offset; n < position; n++) pcm.append(vgm[n]);
+		}
+		return 0;
+	}
+	if ((command & 0xf0) == 0x80) {
+		writeYM2612(0x2a, pcmOffset < pcm.size() ? pcm[pcmOffset] : 0x80);
+		pcmOffset++;
+		return command & 15;
+	}
+	if (command == 0xe0) {
+		pcmOffset = read32();
+		return 0;
+	}
+
+	if (command == 0x66) return -1;
+
+	// Commands for other chips, and DAC stream control; only their operands need to be skipped:
+	uint operands = 0;
+	if (command >= 0x30 && command <= 0x3f) operands = 1;
+	else if (command >= 0x40 && command <= 0x4e) operands = 2;
+	else if (command >= 0x51 && command <= 0x5f) operands = 2;
+	else if (command == 0x68) operands = 11;
+	else if (command == 0x90 || command == 0x91 || command == 0x95) operands = 4;
+	else if (command == 0x92) operands = 5;
+	else if (command == 0x93) operands = 10;
+	else if (command == 0x94) operands = 1;
+	else if (command >= 0xa0 && command <= 0xbf) operands = 2;
+	else if (command >= 0xc0 && command <= 0xdf) operands = 3;
+	else if (command >= 0xe1) operands = 4;
+	else {
+		// Undefined; the rest of the stream cannot be parsed:
+		print("\nUnknown VGM command ", hex(command, 2), " at ", hex(position - 1, 8), "\n");
+		return -1;
+	}
+	position += operands;
+	return 0;
+}
+
+auto VGMPlayer::writeYM2612(uint9 address, uint8_t data) -> void {
+	if (transcriber) transcriber->write(elapsed, address, data);
+	if (!render) return;
+	ym2612->writeAddress(address);
+	ym2612->writeData(data);
+}
+
+auto VGMPlayer::advance(uint waits) -> void {
+	elapsed += waits;
+	if (!render) return;
+
+	// Clock the sound chips directly up to the stream time; there is no CPU to schedule against.
+	// Whichever chip is behind runs first, so neither gets far enough ahead to overflow its stream:
+	clock += waits * waitScalar;
+	while (ym2612->clock() < clock || psg->clock() < clock) {
+		if (ym2612->clock() <= psg->clock()) ym2612->main();
+		else psg->main();
+	}
+
+	// Keep the clocks relative to the stream time, as the scheduler would when it exits:
+	ym2612->setClock(ym2612->clock() - clock);
+	psg->setClock(psg->clock() - clock);
+	clock = 0;
+}
+
+auto VGMPlayer::run(string filename, Arguments arguments) -> void {
+	// Optional MIDI transcription of the FM channels, with a patch table alongside;
+	// audio is then only rendered when asked for with --wav true:
+	string midiFilename;
+	if (arguments.take("--midi", midiFilename)) midiFilename = outputName(midiFilename);
+	render = !midiFilename;
+	arguments.take("--wav", render);
+
+	// VGZ files are decompressed as they are read:
+	vgm = archive.map(filename);
+
+	if (vgm.size() < 0x40 || memory::compare(vgm.data(), "Vgm ", 4)) {
+		print("Missing header for VGM!\n");
+		return;
+	}
+
+	// Header fields:
+	position = 0x08;
+	auto version = read32();
+	auto psgClock = read32() & 0x3fffffff;  // d30,d31 = dual chip and T6W28 flags
+	position = 0x18;
+	auto totalSamples = read32();
+	auto loopOffset = read32();
+	auto loopSamples = read32();
+	if (loopOffset) loopOffset += 0x1c;
+	position = 0x2c;
+	auto ymClock = version >= 0x110 ? read32() & 0x3fffffff : 0;
+	position = 0x34;
+	auto dataOffset = version >= 0x150 ? read32() : 0;
+	position = dataOffset ? 0x34 + dataOffset : 0x40;
+
+	if (!ymClock && !psgClock) {
+		print("VGM uses no YM2612 or SN76489\n");
+		return;
+	}
+	// Mega Drive clocks are fixed fractions of the master clock; 7600489Hz and 3546894Hz are PAL:
+	region = ymClock ? (ymClock < 7635000 ? "PAL" : "NTSC-U") : (psgClock < 3563000 ? "PAL" : "NTSC-U");
+
+	if (midiFilename) {
+		transcriber = new FMTranscriber;
+		if (ymClock) transcriber->clock = ymClock;
+	}
+
+	if (render) {
+		Emulator::audio.setFrequency(48000);
+		Emulator::audio.setVolume(1.0);
+		Emulator::audio.setBalance(0.0);
+
+		ym2612 = &MegaDrive::ym2612;
+		psg = &MegaDrive::psg;
+
+		// Load and power up only the YM2612 and PSG; the command stream writes them directly:
+		md = new MegaDrive::Interface;
+		md->set("Sound Only", true);
+
+		if (!md->load()) {
+			print("Mega Drive failed load()\n");
+			return;
+		}
+		md->power();
+
+		wave = openWave(outputFilename);
+	}
+	samples = 0;
+
+	clock = 0;
+	waitScalar = Emulator::Thread::Second / 44100;
+	elapsed = 0;
+
+	// Play through once, then the looped section once more:
+	long length = totalSamples + (loopOffset && loopSamples ? loopSamples : 0);
+	uint wait = 0;  // Samples left of the current wait.
+	long loopedAt = -1;  // Time of the last jump back to the loop; a loop that waits for nothing ends playback.
+
+	int seconds = 0;
+	print("time: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+	while (elapsed < length) {
+		long until = min(length, (seconds + 1) * 44100l);
+		while (elapsed < until) {
+			if (!wait) {
+				auto waits = execute();
+				if (waits < 0) {
+					if (loopOffset && loopSamples && loopedAt != elapsed) {
+						loopedAt = elapsed;
+						position = loopOffset;
+						continue;
+					}
+					length = until = elapsed;
+					break;
+				}
+				wait = waits;
+				continue;
+			}
+
+			uint waits = min((long)wait, until - elapsed);
+			advance(waits);
+			wait -= waits;
+		}
+		if (elapsed == (seconds + 1) * 44100l) {
+			seconds++;
+			print("\b\b\b\b\b\b\b\b\b\b\b\rtime: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+		}
+	}
+	print("\n");
+
+	if (transcriber) {
+		transcriber->finish(elapsed);
+		if (!transcriber->midi.save(midiFilename, elapsed)) {
+			print("Failed to write ", midiFilename, "\n");
+		}
+		transcriber->exportPatches({Location::notsuffix(midiFilename), ".patches.bml"});
+	}
+	if (!render) return;
+
+	closeWave(wave, 2, 16, 48000, samples);
+}
@@ -0,0 +1,47 @@
+// WAVE output, shared by the players. The header is only known once every sample is written,
+// so space is left for it on open and it is filled in on close:
+static const uint waveHeaderSize = 0x2C;
+
+enum class WaveFormat : uint { PCM = 1, Float = 3 };
+
+auto openWave(const string& filename) -> file_buffer {
+	auto fp = file::open(filename, file::mode::write);
+	fp.truncate(waveHeaderSize);
+	fp.seek(waveHeaderSize);
+	return fp;
+}
+
+// Frames are counted across all channels; a stereo frame is one left and one right sample:
+auto closeWave(file_buffer& fp, uint channels, uint bits, uint rate, long frames, WaveFormat format = WaveFormat::PCM) -> void {
+	uint frameSize = channels * bits / 8;
+	uint dataSize = frames * frameSize;
+	uint riffSize = waveHeaderSize - 8 + dataSize;
+	uint byteRate = rate * frameSize;
+
+	uint8_t header[waveHeaderSize];
+	auto put16 = [&](uint offset, uint value) {
+		header[offset + 0] = (uint8_t)(value >> 0);
+		header[offset + 1] = (uint8_t)(value >> 8);
+	};
+	auto put32 = [&](uint offset, uint value) {
+		put16(offset + 0, value >> 0);
+		put16(offset + 2, value >> 16);
+	};
+
+	memory::copy(header + 0x00, "RIFF", 4);
+	put32(0x04, riffSize);          // length of rest of file
+	memory::copy(header + 0x08, "WAVEfmt ", 8);
+	put32(0x10, 0x10);              // size of fmt chunk
+	put16(0x14, (uint)format);
+	put16(0x16, channels);
+	put32(0x18, rate);
+	put32(0x1c, byteRate);          // bytes per second
+	put16(0x20, frameSize);         // bytes per sample frame
+	put16(0x22, bits);              // bits per sample
+	memory::copy(header + 0x24, "data", 4);
+	put32(0x28, dataSize);          // size of sample data
+
+	fp.seek(0);
+	fp.write({header, waveHeaderSize});
+	fp.close();
+}
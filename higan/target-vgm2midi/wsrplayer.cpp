@@ -0,0 +1,227 @@
+#include <ws/ws.hpp>
+
+struct WSRPlayer : Emulator::Platform {
+	~WSRPlayer();
+	auto run(string filename, Arguments arguments) -> void;
+
+	// Hard-coded manifest.bml for WonderSwan; there is no IPL, and the internal EEPROM goes unused:
+	string ws_sys_manifest = "system name:WonderSwan";
+
+	// Generated manifest and supporting data for WSR file:
+	string manifest;
+	vector<uint8_t> prgrom;
+
+	// Length and fade of the render:
+	PlayTime playTime;
+
+	// Per-channel output; each channel as the DAC sees it, to channel1.wav - channel5.wav at 24KHz:
+	file_buffer channelWave[5];
+	long channelSamples;
+	auto captureChannels() -> void;
+
+	// WAVE file writing out:
+	file_buffer wave;
+	long samples;
+
+	WonderSwan::Interface* ws = nullptr;
+
+	WonderSwan::CPU* cpu;
+	WonderSwan::APU* apu;
+	WonderSwan::Scheduler* scheduler;
+
+	// Emulator::Platform
+	auto path(uint id) -> string override;
+	auto open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file override;
+	auto load(uint id, string name, string type, vector<string> options = {}) -> Emulator::Platform::Load override;
+	auto videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void override;
+	auto audioSample(const double* samples, uint channels) -> void override;
+	auto inputPoll(uint port, uint device, uint input) -> int16 override;
+	auto inputRumble(uint port, uint device, uint input, bool enable) -> void override;
+	auto dipSettings(Markup::Node node) -> uint override;
+	auto notify(string text) -> void override;
+};
+
+WSRPlayer::~WSRPlayer() {
+	if (ws) ws->unload();
+	delete ws;
+}
+
+auto WSRPlayer::path(uint id) -> string {
+	return "";
+}
+auto WSRPlayer::open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file {
+	if (id == WonderSwan::ID::System) {
+		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(ws_sys_manifest.data<uint8_t>(), ws_sys_manifest.size());
+		}
+	} else {
+		// WonderSwan or WonderSwan Color:
+		if (name == "manifest.bml" && mode == vfs::file::mode::read) {
+			// Load the manifest generated from the WSR file:
+			return vfs::memory::file::view(manifest.data<uint8_t>(), manifest.size());
+		} else if (name == "program.rom" && mode == vfs::file::mode::read) {
+			return vfs::memory::file::view(prgrom.data<uint8_t>(), prgrom.size());
+		}
+	}
+
+	if (required) {
+		print("platform::open  Missing required file {0}\n", string_format{name});
+	}
+
+	return {};
+}
+auto WSRPlayer::load(uint id, string name, string type, vector<string> options) -> Emulator::Platform::Load {
+	return {id};
+}
+auto WSRPlayer::videoRefresh(uint display, const uint32* data, uint pitch, uint width, uint height) -> void {
+}
+auto WSRPlayer::audioSample(const double* samples, uint channels) -> void {
+	// WonderSwan APU is stereo:
+	assert(channels == 2);
+
+	// The last frame runs past the end:
+	double time = this->samples / 48000.0;
+	if (time >= playTime.total()) return;
+
+	// Write 16-bit samples:
+	auto x = (int16_t)(samples[0] * playTime.gain(time) * 32767.0);
+	auto y = (int16_t)(samples[1] * playTime.gain(time) * 32767.0);
+	wave.write({&x, sizeof(int16_t)});
+	wave.write({&y, sizeof(int16_t)});
+	this->samples++;
+}
+auto WSRPlayer::inputPoll(uint port, uint device, uint input) -> int16 {
+	return 0;
+}
+auto WSRPlayer::inputRumble(uint port, uint device, uint input, bool enable) -> void {}
+auto WSRPlayer::dipSettings(Markup::Node node) -> uint {
+	return 0;
+}
+auto WSRPlayer::notify(string text) -> void {
+	print("notify(\"{0}\")\n", string_format{text});
+}
+
+auto WSRPlayer::captureChannels() -> void {
+	double time = channelSamples / 24000.0;
+	if (time >= playTime.total()) return;
+
+	// Each channel at the DAC's scale, whether or not the headphone output is enabled:
+	auto write = [&](uint n, bool enable, int left, int right) {
+		int16_t x = enable ? sclamp<16>(left << 5) * playTime.gain(time) : 0;
+		int16_t y = enable ? sclamp<16>(right << 5) * playTime.gain(time) : 0;
+		channelWave[n].write({&x, sizeof(int16_t)});
+		channelWave[n].write({&y, sizeof(int16_t)});
+	};
+	write(0, apu->channel1.r.enable, apu->channel1.o.left, apu->channel1.o.right);
+	write(1, apu->channel2.r.enable, apu->channel2.o.left, apu->channel2.o.right);
+	write(2, apu->channel3.r.enable, apu->channel3.o.left, apu->channel3.o.right);
+	write(3, apu->channel4.r.enable, apu->channel4.o.left, apu->channel4.o.right);
+	write(4, apu->channel5.r.enable, apu->channel5.o.left, apu->channel5.o.right);
+	channelSamples++;
+}
+
+auto WSRPlayer::run(string filename, Arguments arguments) -> void {
+	playTime.take(arguments);
+
+	// Optional per-channel output:
+	bool splitChannels = false;
+	arguments.take("--channels", splitChannels);
+
+	auto buf = archive.map(filename);
+	if (buf.size() < 0x20 || memory::compare(buf.data() + buf.size() - 0x20, "WSRF", 4)) {
+		print("Missing WSRF footer for WSR!\n");
+		return;
+	}
+	auto footer = buf.data() + buf.size() - 0x20;
+	auto version = footer[0x04];
+	auto first_song = footer[0x05];
+	// The cartridge footer follows; its reset vector enters the player, and d0 of $07 marks a color title:
+	bool color = footer[0x17] & 1;
+
+	// Track number; passed in AL at reset, and defaults to the footer's first song:
+	auto track_s = arguments.take();
+	auto track = track_s ? track_s.natural() : first_song;
+
+	// The ROM is mapped against the top of the address space, so pad the front to a power of two:
+	uint size = bit::round(buf.size());
+	prgrom.resize(size);
+	prgrom.fill(0xFF);
+	memory::copy(prgrom.data() + size - buf.size(), buf.data(), buf.size());
+
+	// Build a temporary manifest for cartridge to load:
+	manifest = "";
+	manifest.append("game\n");
+	manifest.append("  label:  ", Location::prefix(filename), "\n");
+	manifest.append("  name:   ", filename, "\n");
+	manifest.append("  board\n");
+	manifest.append("    memory\n");
+	manifest.append("      type: ", "ROM", "\n");
+	manifest.append("      size: 0x", hex(prgrom.size()), "\n");
+	manifest.append("      content: ", "Program", "\n");
+	manifest.append("    memory\n");
+	manifest.append("      type: ", "RAM", "\n");
+	manifest.append("      size: 0x10000\n");
+	manifest.append("      content: ", "Save", "\n");
+	manifest.append("      volatile\n");
+
+	print("version: {0}, first song: {1}, {2}\n", string_format{version, first_song, color ? "color" : "mono"});
+
+	Emulator::audio.setFrequency(48000);
+	Emulator::audio.setVolume(1.0);
+	Emulator::audio.setBalance(0.0);
+
+	if (color) {
+		ws_sys_manifest = "system name:WonderSwan Color";
+		ws = new WonderSwan::WonderSwanColorInterface;
+	} else {
+		ws = new WonderSwan::WonderSwanInterface;
+	}
+	if (!ws->load()) {
+		print("WonderSwan failed load()\n");
+		return;
+	}
+	// No video; the PPU keeps its scanline timing for the vblank and timer interrupts:
+	WonderSwan::ppu.disabled = true;
+
+	ws->power();
+
+	cpu = &WonderSwan::cpu;
+	apu = &WonderSwan::apu;
+	scheduler = &WonderSwan::scheduler;
+
+	cpu->V30MZ::r.al = track;
+
+	if (splitChannels) {
+		for (uint n : range(5)) {
+			channelWave[n] = openWave(outputName({"channel", n + 1, ".wav"}));
+		}
+		channelSamples = 0;
+		apu->capture = {&WSRPlayer::captureChannels, this};
+	}
+
+	wave = openWave(outputFilename);
+	samples = 0;
+
+	const long total_samples = (long)(playTime.total() * 48000);
+
+	int seconds = 0;
+	print("time: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+	do
+	{
+		scheduler->enter();
+		if (samples / 48000 > seconds) {
+			seconds = samples / 48000;
+			print("\b\b\b\b\b\b\b\b\b\b\b\rtime: {0}:{1}", string_format{pad(seconds / 60, 2, '0'), pad(seconds % 60, 2, '0')});
+		}
+	} while (samples < total_samples);
+	print("\n");
+
+	if (splitChannels) {
+		apu->capture.reset();
+		for (uint n : range(5)) {
+			closeWave(channelWave[n], 2, 16, 24000, channelSamples);
+		}
+	}
+
+	closeWave(wave, 2, 16, 48000, samples);
+}
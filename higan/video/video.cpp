@@ -13,11 +13,11 @@ auto Video::reset(Interface* interface) -> void {
   this->interface = interface;
 
   sprites.reset();
-  delete buffer;
+  delete[] buffer;
   buffer = nullptr;
-  delete rotate;
+  delete[] rotate;
   rotate = nullptr;
-  delete palette;
+  delete[] palette;
   palette = nullptr;
   width = 0;
   height = 0;
@@ -29,7 +29,7 @@ auto Video::reset(Interface* interface) -> void {
 auto Video::setPalette() -> void {
   if(!interface) return;
 
-  delete palette;
+  delete[] palette;
   colors = interface->displays()[0].colors;
   palette = new uint32[colors];
   for(auto index : range(colors)) {
@@ -109,8 +109,8 @@ auto Video::removeSprite(shared_pointer<Sprite> sprite) -> bool {
 
 auto Video::refresh(uint32* input, uint pitch, uint width, uint height) -> void {
   if(this->width != width || this->height != height) {
-    delete buffer;
-    delete rotate;
+    delete[] buffer;
+    delete[] rotate;
     buffer = new uint32[width * height]();
     rotate = new uint32[height * width]();
     this->width = width;
@@ -23,7 +23,7 @@ auto APU::main() -> void {
   channel3.run();
   channel4.run();
   channel5.run();
-  dacRun();
+  if(++s.dacClock == 0) dacRun();  //the DAC mixes the channels at 24khz
   if(++s.sweepClock == 0) channel3.sweep();
   step(1);
 }
@@ -36,6 +36,8 @@ auto APU::sample(uint channel, uint5 index) -> uint4 {
 }
 
 auto APU::dacRun() -> void {
+  if(capture) capture();
+
   int left = 0;
   if(channel1.r.enable) left += channel1.o.left;
   if(channel2.r.enable) left += channel2.o.left;
@@ -67,7 +69,7 @@ auto APU::step(uint clocks) -> void {
 
 auto APU::power() -> void {
   create(APU::Enter, 3'072'000);
-  stream = Emulator::audio.createStream(2, frequency());
+  stream = Emulator::audio.createStream(2, frequency() / 128.0);
   stream->addFilter(Emulator::Filter::Order::First, Emulator::Filter::Type::HighPass, 20.0);
 
   bus.map(this, 0x004a, 0x004c);
@@ -76,6 +78,7 @@ auto APU::power() -> void {
   bus.map(this, 0x006a, 0x006b);
   bus.map(this, 0x0080, 0x0095);
 
+  s.dacClock = 0;
   s.sweepClock = 0;
   r.waveBase = 0;
   r.speakerEnable = 0;
@@ -16,9 +16,13 @@ struct APU : Thread, IO {
   auto serialize(serializer&) -> void;
 
   struct State {
+    uint7 dacClock;
     uint13 sweepClock;
   } s;
 
+  //called at each DAC sample, before the channels are mixed
+  function<void ()> capture;
+
   struct Registers {
     //$008f  SND_WAVE_BASE
     uint8 waveBase;
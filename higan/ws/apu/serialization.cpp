@@ -1,6 +1,7 @@
 auto APU::serialize(serializer& s) -> void {
   Thread::serialize(s);
 
+  s.integer(this->s.dacClock);
   s.integer(this->s.sweepClock);
   s.integer(r.waveBase);
   s.integer(r.speakerEnable);
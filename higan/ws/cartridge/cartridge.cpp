@@ -107,10 +107,15 @@ auto Cartridge::load() -> bool {
 
   information.title = document["game/label"].text();
   information.orientation = document["game/orientation"].text() == "vertical";
-  information.sha256 = Hash::SHA256({rom.data, rom.size}).digest();
   return true;
 }
 
+//hashed on first use: only the cheat tools ask for it
+auto Cartridge::hash() -> string {
+  if(!information.sha256 && rom.data) information.sha256 = Hash::SHA256({rom.data, rom.size}).digest();
+  return information.sha256;
+}
+
 auto Cartridge::save() -> void {
   auto document = BML::unserialize(information.manifest);
 
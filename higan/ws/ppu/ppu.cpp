@@ -17,7 +17,7 @@ auto PPU::main() -> void {
     latchOAM();
   }
 
-  if(s.vclk < 144) {
+  if(s.vclk < 144 && !disabled) {
     latchRegisters();
     latchSprites();
     for(auto x : range(224)) {
@@ -37,6 +37,9 @@ struct PPU : Thread, IO {
 
   uint32 output[224 * 144];
 
+  //no rendering; scanline timing and interrupts are kept
+  bool disabled = false;
+
   struct State {
     bool field = 0;
     uint vclk = 0;
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <nall/vector.hpp>
+#include <nall/dsp/dsp.hpp>
+
+//band-limited step synthesis:
+//amplitude changes are recorded at input clock timestamps, and a windowed-sinc
+//impulse is added at the matching output sample position for each one.
+//integrating the buffer yields the band-limited waveform directly at the output rate,
+//so sources that change rarely cost nothing between changes.
+
+namespace nall { namespace DSP { namespace Synthesis {
+
+struct Blip {
+  enum : uint {
+    Width = 16,      //impulse length, in output samples
+    Phases = 64,     //sub-sample impulse positions
+    PhaseShift = 6,  //log2(Phases)
+    Shift = 15,      //impulse precision; each phase sums to 1 << Shift
+  };
+
+  inline auto reset(double clockFrequency, double sampleFrequency, uint maximumClocks) -> void;
+  inline auto addDelta(uint clock, int delta) -> void;  //clock is relative to the start of the frame
+  inline auto endFrame(uint clocks) -> void;
+  inline auto pending() const -> uint;
+  inline auto read() -> int;
+
+private:
+  uint64_t factor;  //output samples per input clock (32.32 fixed point)
+  uint64_t offset;  //fractional output sample position of the current frame
+  uint available;   //samples completed and ready to be read
+  uint position;    //read position within buffer
+  int64_t integrator;
+  vector<int64_t> buffer;
+  int16_t kernel[Phases][Width];
+};
+
+auto Blip::reset(double clockFrequency, double sampleFrequency, uint maximumClocks) -> void {
+  factor = sampleFrequency / clockFrequency * (double)(1ull << 32) + 0.5;
+  offset = 0;
+  available = 0;
+  position = 0;
+  integrator = 0;
+
+  buffer.reset();
+  buffer.resize(maximumClocks * sampleFrequency / clockFrequency + Width + 2);
+  for(auto& sample : buffer) sample = 0;
+
+  //Blackman-windowed sinc, cut off slightly below the output Nyquist frequency
+  const double cutoff = 0.90;
+  for(uint phase : range(Phases)) {
+    double taps[Width];
+    double sum = 0.0;
+    for(uint tap : range(Width)) {
+      double x = (double)tap - Width / 2 - (double)phase / Phases;
+      double sinc = x == 0.0 ? 1.0 : sin(Math::Pi * cutoff * x) / (Math::Pi * cutoff * x);
+      double window = 0.42 + 0.50 * cos(Math::Pi * x / (Width / 2)) + 0.08 * cos(2.0 * Math::Pi * x / (Width / 2));
+      if(x <= -(double)(Width / 2) || x >= (double)(Width / 2)) window = 0.0;
+      sum += taps[tap] = sinc * window;
+    }
+
+    //normalize each phase so that a step always settles to exactly delta << Shift
+    int total = 0;
+    uint peak = 0;
+    for(uint tap : range(Width)) {
+      kernel[phase][tap] = taps[tap] / sum * (1 << Shift) + (taps[tap] < 0 ? -0.5 : 0.5);
+      total += kernel[phase][tap];
+      if(kernel[phase][tap] > kernel[phase][peak]) peak = tap;
+    }
+    kernel[phase][peak] += (1 << Shift) - total;
+  }
+}
+
+auto Blip::addDelta(uint clock, int delta) -> void {
+  uint64_t fixed = offset + clock * factor;
+  int64_t* target = buffer.data() + position + available + (fixed >> 32);
+  const int16_t* impulse = kernel[(fixed >> 32 - PhaseShift) & Phases - 1];
+  for(uint tap : range(Width)) target[tap] += (int64_t)delta * impulse[tap];
+}
+
+auto Blip::endFrame(uint clocks) -> void {
+  uint64_t fixed = offset + clocks * factor;
+  available += fixed >> 32;
+  offset = fixed & 0xffffffffull;
+}
+
+auto Blip::pending() const -> uint {
+  return available;
+}
+
+auto Blip::read() -> int {
+  integrator += buffer[position];
+  buffer[position++] = 0;
+  if(!--available) {
+    //move the impulse tails that extend past the frame back to the start of the buffer
+    for(uint n : range(Width + 1)) {
+      buffer[n] = buffer[position + n];
+      buffer[position + n] = 0;
+    }
+    position = 0;
+  }
+  return integrator >> Shift;
+}
+
+}}}
@@ -53,7 +53,7 @@ struct hashset {
           pool[n] = nullptr;
         }
       }
-      delete pool;
+      delete[] pool;
       pool = nullptr;
     }
     length = 8;
@@ -76,7 +76,7 @@ struct hashset {
       }
     }
 
-    delete pool;
+    delete[] pool;
     pool = copy;
     length = size;
   }
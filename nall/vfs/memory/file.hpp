@@ -3,7 +3,7 @@
 namespace nall { namespace vfs { namespace memory {
 
 struct file : vfs::file {
-  ~file() { delete[] _data; }
+  ~file() { if(_owned) delete[] _data; }
 
   static auto open(const void* data, uintmax size) -> vfs::shared::file {
     auto instance = shared_pointer<file>{new file};
@@ -11,6 +11,13 @@ struct file : vfs::file {
     return instance;
   }
 
+  //reads the memory in place rather than from a copy; it must outlive the file, which is read-only
+  static auto view(const void* data, uintmax size) -> vfs::shared::file {
+    auto instance = shared_pointer<file>{new file};
+    instance->_view((const uint8_t*)data, size);
+    return instance;
+  }
+
   auto size() const -> uintmax override { return _size; }
   auto offset() const -> uintmax override { return _offset; }
 
@@ -25,7 +32,7 @@ struct file : vfs::file {
   }
 
   auto write(uint8_t data) -> void override {
-    if(_offset >= _size) return;
+    if(_offset >= _size || !_owned) return;
     _data[_offset++] = data;
   }
 
@@ -40,9 +47,16 @@ private:
     nall::memory::copy(_data, data, size);
   }
 
+  auto _view(const uint8_t* data, uintmax size) -> void {
+    _size = size;
+    _data = (uint8_t*)data;
+    _owned = false;
+  }
+
   uint8_t* _data = nullptr;
   uintmax _size = 0;
   uintmax _offset = 0;
+  bool _owned = true;
 };
 
 }}}
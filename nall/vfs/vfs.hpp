@@ -1,5 +1,6 @@
 #pragma once
 
+#include <nall/array-span.hpp>
 #include <nall/range.hpp>
 #include <nall/shared-pointer.hpp>
 
@@ -28,6 +29,10 @@ struct file {
     while(bytes--) *data++ = read();
   }
 
+  auto read(array_span<uint8_t> memory) -> void {
+    for(auto& byte : memory) byte = read();
+  }
+
   auto readl(uint bytes) -> uintmax {
     uintmax data = 0;
     for(auto n : range(bytes)) data |= (uintmax)read() << n * 8;
@@ -47,6 +52,13 @@ struct file {
     return s;
   }
 
+  auto reads(uint length) -> string {
+    string s;
+    s.resize(length);
+    read(s.get<uint8_t>(), s.size());
+    return s;
+  }
+
   auto write(const void* vdata, uintmax bytes) -> void {
     auto data = (const uint8_t*)vdata;
     while(bytes--) write(*data++);